@@ -0,0 +1,30 @@
+# Turns a "word,hint" CSV word list into a header of HANGMAN_EMBEDDED_WORD("WORD", "HINT") entries,
+# which src/main.cpp expands into a constexpr array that the game falls back to when data.csv is missing.
+# Usage: cmake -DINPUT=<csv> -DOUTPUT=<header> -P EmbedWordList.cmake
+
+file(READ "${INPUT}" CONTENT)
+
+# Escape the characters that are special in C string literals, ';' which CMake treats as a list separator, and
+# '[' and ']', inside which CMake does not split lists (an unbalanced '[' would merge every following line into one)
+string(REPLACE "\\" "\\\\" CONTENT "${CONTENT}")
+string(REPLACE "\"" "\\\"" CONTENT "${CONTENT}")
+string(REPLACE ";" "\\073" CONTENT "${CONTENT}")
+string(REPLACE "[" "\\133" CONTENT "${CONTENT}")
+string(REPLACE "]" "\\135" CONTENT "${CONTENT}")
+string(REPLACE "\r" "" CONTENT "${CONTENT}")
+string(REGEX MATCHALL "[^\n]+" LINES "${CONTENT}")
+
+set(ENTRIES "")
+foreach(LINE IN LISTS LINES)
+    # Like the game's loaders: the word ends at the first comma, rows without one and deleted rows ('#') are skipped
+    string(FIND "${LINE}" "," COMMA)
+    string(SUBSTRING "${LINE}" 0 1 FIRST)
+    if(COMMA GREATER -1 AND NOT FIRST STREQUAL "#")
+        string(SUBSTRING "${LINE}" 0 ${COMMA} WORD)
+        math(EXPR HINT_START "${COMMA} + 1")
+        string(SUBSTRING "${LINE}" ${HINT_START} -1 HINT)
+        string(APPEND ENTRIES "HANGMAN_EMBEDDED_WORD(\"${WORD}\", \"${HINT}\")\n")
+    endif()
+endforeach()
+
+file(WRITE "${OUTPUT}" "// Generated from ${INPUT} by cmake/EmbedWordList.cmake; do not edit.\n${ENTRIES}")
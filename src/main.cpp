@@ -11,33 +11,69 @@
  * This program implements a text-based Hangman game with single-player, multi-player, and interactive multiplayer modes (plus a word list management mode).
  * The game additionally features a variable difficulty level, whole word guessing, word list management, game statistics, and interactive menus.
  * The program utilizes enum to define game modes, struct to store words & hints/game state+stats, and a wrapper struct for player state (to persist stats).
- * Vector is used to store the word list in a dynamic array, pointers are used in multiplayer to iterate between player turns, and arrays are used for gallows drawing.
+ * Vector is used to store views of the word list rows in a dynamic array, pointers are used in multiplayer to iterate between player turns, and arrays are used for gallows drawing.
  * References are used to pass game/player states, word list, and filenames.
  *
  * ====== GAMEPLAY LOGIC ======
- * main() initializes the game by reading the word list from a file into a vector and calling playGame() to start the game menu.
+ * main() initializes the game by memory-mapping the word list file, indexing its rows as zero-copy views, and calling playGame() to start the game menu.
+ * When an up-to-date compiled word list (data.hwl, produced by `HangmanGame --compile`) is present, it is mapped instead and no CSV parsing happens.
+ * The list is published as an immutable snapshot by WordListStore, which reloads it in the background when data.csv changes (inotify on Linux).
  * playGame() displays the game mode menu, processes user input, and calls the appropriate game mode function based on the user's choice.
  * The game modes include single-player, multiplayer, interactive multiplayer, and word list management.
- * Single-player mode selects a random word from the list for the player to guess, updating the game state and displaying the gallows and word.
+ * Single-player mode selects a random word suited to the difficulty (via an index of words bucketed by length and distinct letters) for the player to guess, updating the game state and displaying the gallows and word.
  * Multiplayer mode allows two players to take turns guessing the same word, with pointers to player states for easy iteration between turns.
  * Interactive multiplayer mode has one player input a word and hint, while the other player guesses the word, with the game state updating after each guess.
  * Word list management mode allows viewing and adding words to the list, displaying the current words and hints, and appending new words to the file.
  * The game prompts are handled using getValidatedInput() to ensure valid input, with clearScreen() to improve readability and clearInputBuffer() to prevent invalid input.
- * The full word guess is handled by wordGuess(), while handleCharacterGuess() processes single letter guesses, updating the game state accordingly.
+ * The game rules live in an I/O-free engine (newGame(), guessLetter(), guessWord(), gameStatus()) that returns result codes instead of printing.
+ * The full word guess is handled by wordGuess(), while handleCharacterGuess() processes single letter guesses; both are console front-ends over the engine.
  * The game difficulty is set using selectDifficultyLevel() and setupDifficulty(), and  GameState is initialized with the chosen difficulty level.
  * The datafile (data.csv) is included as a separate file.
  */
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cctype>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
 #include <cstdlib>
-#include <ctime>
+#include <cstring>
 #include <fstream>
+#include <functional>
+#include <future>
 #include <iostream>
 #include <limits>
+#include <memory>
+#include <mutex>
+#include <sstream>
 #include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
+#include <sys/stat.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#define HANGMAN_HAVE_MMAP 1
+#endif
+
+#ifdef __linux__
+#include <poll.h>
+#include <sys/inotify.h>
+#define HANGMAN_HAVE_INOTIFY 1
+#endif
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define HANGMAN_HAVE_X86_SIMD 1  // SSE2 when the target has it, AVX2 chosen at runtime.
+#endif
+
 using namespace std;
 
 #define MAXSIZE 10  // Maximum number of words in the list
@@ -56,13 +92,623 @@ enum GameMode {
 };
 
 /**
- * @struct wordItem
- * @brief Represents a word and its associated hint within the game.
- * Struct to hold word items that include both the word itself and a hint to aid the player in guessing.
+ * @enum GuessResult
+ * @brief What a single guess did to a game, as reported by guessLetter() and guessWord().
+ */
+enum GuessResult {
+    GUESS_HIT = 0,    // The letter is in the word, or the word guess was right.
+    GUESS_MISS,       // The letter is not in the word, or the word guess was wrong.
+    GUESS_REPEATED,   // The letter was guessed before; no penalty.
+    GUESS_INVALID,    // Not a letter from 'A' to 'Z'; the game is unchanged.
+    GUESS_GAME_OVER   // The game had already ended; the game is unchanged.
+};
+
+/**
+ * @enum GameStatus
+ * @brief Whether a game is still being played, and how it ended.
+ */
+enum GameStatus {
+    GAME_IN_PROGRESS = 0,
+    GAME_WON,
+    GAME_LOST
+};
+
+/**
+ * @struct StrView
+ * @brief A non-owning view of a run of characters (a C++11 stand-in for string_view).
+ * Used to refer to words and hints in place inside a mapped word list file without copying them.
+ */
+struct StrView {
+    const char* data;  // First character of the view (not null-terminated).
+    size_t size;       // Number of characters in the view.
+
+    StrView() : data(nullptr), size(0) {}
+    StrView(const char* data, size_t size) : data(data), size(size) {}
+    string str() const { return string(data, size); }  // Copies the view into an owning string.
+};
+
+inline bool operator==(const StrView& left, const StrView& right) {
+    return left.size == right.size && (left.size == 0 || memcmp(left.data, right.data, left.size) == 0);
+}
+
+/**
+ * @struct StrViewHash
+ * @brief FNV-1a hash of the characters in a StrView, so views can key unordered containers without copying.
+ */
+struct StrViewHash {
+    size_t operator()(const StrView& text) const {
+        uint64_t hash = 14695981039346656037ULL;
+        for (size_t i = 0; i < text.size; i++) {
+            hash = (hash ^ static_cast<unsigned char>(text.data[i])) * 1099511628211ULL;
+        }
+        return static_cast<size_t>(hash);
+    }
+};
+
+/**
+ * @struct WordView
+ * @brief A word of the loaded list, referenced in place inside the mapped word list file.
+ * The hint is stored as an id into the list's HintTable, since the same few hints are shared by thousands of words.
+ * At 16 bytes per word, loading needs no per-word allocation.
+ */
+struct WordView {
+    const char* word;     // First character of the word to be guessed (not null-terminated).
+    uint32_t wordLength;  // Length of the word in bytes.
+    uint32_t hintId;      // Index of the word's hint in the list's HintTable.
+};
+
+/**
+ * @class HintTable
+ * @brief Interns the distinct hints of a word list and assigns each a small integer id.
+ * Hints are kept as views into the mapped file, so interning copies no text.
+ */
+class HintTable {
+   public:
+    HintTable() : lastId(0) {}
+    uint32_t intern(const StrView& text);                 // Returns the id of a hint, adding it if it is new.
+    StrView text(uint32_t id) const { return texts[id]; }  // Resolves an id back to the hint text.
+    size_t size() const { return texts.size(); }
+    void clear() {
+        texts.clear();
+        ids.clear();
+    }
+
+   private:
+    vector<StrView> texts;                                // Hint text by id.
+    unordered_map<StrView, uint32_t, StrViewHash> ids;    // Id by hint text.
+    StrView lastText;                                     // Most recently interned hint; consecutive rows often share one.
+    uint32_t lastId;                                      // Id of lastText.
+};
+
+/**
+ * @class MappedFile
+ * @brief Owns a read-only memory mapping of a whole file.
+ * On POSIX systems the file is mapped with mmap so its pages are shared with the page cache; elsewhere the file is read into a buffer.
+ * The mapping is released when the object is destroyed, so views into it must not outlive it.
+ */
+class MappedFile {
+   public:
+    MappedFile() : bytes(nullptr), length(0) {}
+    MappedFile(MappedFile&& other) : bytes(other.bytes), length(other.length), buffer(std::move(other.buffer)) {
+        other.bytes = nullptr;
+        other.length = 0;
+    }
+    MappedFile& operator=(MappedFile&& other);
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    ~MappedFile() { close(); }
+
+    bool open(const string& filename, bool sequential = true);  // Maps the file; returns false if it cannot be opened.
+    void close();                       // Releases the mapping (safe to call more than once).
+    const char* data() const { return bytes; }
+    size_t size() const { return length; }
+
+   private:
+    const char* bytes;    // Start of the mapped (or buffered) file contents.
+    size_t length;        // Size of the file in bytes.
+    vector<char> buffer;  // Backing storage when mmap is unavailable.
+};
+
+const char TOMBSTONE_MARKER = '#';             // First byte of a deleted row; loaders skip rows that start with it.
+const size_t COMPACTION_THRESHOLD_PERCENT = 25;  // Share of deleted rows above which the word list is compacted.
+const size_t VIEWER_PAGE_ROWS = 20;              // Rows shown per page of the word list viewer.
+
+/**
+ * @class TextArena
+ * @brief Append-only storage for normalized copies of text, in large blocks so each copy costs no allocation of its own.
+ * Copies never move once made, so views of them stay valid for the life of the arena.
+ */
+class TextArena {
+   public:
+    TextArena() : used(0), capacity(0) {}
+    char* allocate(size_t length);  // Returns room for length bytes.
+
+   private:
+    static const size_t BLOCK_SIZE = 64 * 1024;  // Bytes per block (longer texts get a block of their own).
+    vector<unique_ptr<char[]>> blocks;           // Blocks handed out so far; only the last one has free room.
+    size_t used;                                 // Bytes used in the last block.
+    size_t capacity;                             // Size of the last block.
+};
+
+const size_t TextArena::BLOCK_SIZE;  // Out-of-class definition, needed when BLOCK_SIZE is passed by reference.
+
+/**
+ * @class WordTrie
+ * @brief Compact trie over the words of a list, for prefix and wildcard searches that cost time in proportion to the results.
+ * Nodes live in parallel arrays (first child, next sibling, letter, row) and children are kept in sorted order,
+ * so the trie is built in one pass over the words in sorted order. Each word's last node records its row in the file.
+ */
+class WordTrie {
+   public:
+    static const uint32_t NO_NODE = UINT32_MAX;  // Marks a missing child or sibling, or a node that ends no word.
+
+    template <typename WordAt>
+    void build(size_t count, const WordAt& sortedWord, const vector<uint32_t>& sortedRows);  // Builds from words in sorted order.
+    void clear();
+    bool empty() const { return letters.empty(); }
+    bool search(const StrView& pattern, bool prefix, size_t limit, vector<uint32_t>& rows) const;  // '_' matches any letter.
+
+   private:
+    bool collect(uint32_t node, const StrView& pattern, size_t depth, bool prefix, size_t limit, vector<uint32_t>& rows) const;
+    uint32_t addChild(uint32_t parent, uint32_t lastChild, char letter);
+
+    vector<uint32_t> firstChild;   // First (smallest) child of each node.
+    vector<uint32_t> nextSibling;  // Next larger sibling of each node.
+    vector<uint32_t> wordRows;     // Row of the word ending at each node, or NO_NODE.
+    vector<char> letters;          // Letter on the edge into each node (node 0 is the root).
+};
+
+const uint32_t WordTrie::NO_NODE;  // Out-of-class definition, needed when NO_NODE is passed by reference.
+
+/**
+ * @class WordListIndex
+ * @brief Line-offset index of a word list file for the paged viewer.
+ * Keeps the start of every live row in file order, so a page is one contiguous range of the mapped file,
+ * and the rows sorted by word, so the first word with a given prefix is found by binary search.
+ * Words are indexed in their normalized form (trimmed and uppercased, as the loader reads them), matching the uppercased
+ * searches; only words that need it are copied, into the index's arena.
+ * The index is reused for as long as the file's size and modification time are unchanged.
+ */
+class WordListIndex {
+   public:
+    WordListIndex() : sourceSize(0), sourceModified(0) {}
+    bool refresh(const string& filename);  // Rebuilds the index if the file changed; false if it cannot be read.
+    size_t size() const { return rowStarts.size(); }
+    size_t pageCount() const { return (size() + VIEWER_PAGE_ROWS - 1) / VIEWER_PAGE_ROWS; }
+    StrView page(size_t page) const;         // The bytes spanning the rows of a page (may include deleted rows).
+    StrView word(size_t row) const { return words[row]; }  // The normalized word of a row.
+    size_t findPrefix(const StrView& prefix) const;  // Row of the first word (in sort order) with the prefix, or size().
+    StrView row(size_t row) const;                   // The full "word,hint" text of a row.
+    const WordTrie& trie();                          // The search trie, built on first use after each rebuild.
+
+   private:
+    MappedFile file;               // Mapping of the indexed file.
+    uint64_t sourceSize;           // Size of the file when it was indexed.
+    int64_t sourceModified;        // Modification time of the file when it was indexed.
+    vector<uint64_t> rowStarts;    // Byte offset of each live row, in file order.
+    vector<StrView> words;         // Normalized word of each row, in the mapped file or in arena.
+    TextArena arena;               // Normalized copies of the words stored with lowercase letters.
+    vector<uint32_t> sortedRows;   // Row numbers ordered by word.
+    WordTrie wordTrie;             // Search trie over the words, built lazily.
+};
+
+const char COMPILED_MAGIC[4] = {'H', 'W', 'L', '1'};  // Identifies a compiled word list file.
+const uint32_t COMPILED_VERSION = 6;                   // Bumped whenever the compiled layout changes.
+
+/**
+ * @struct CompiledHeader
+ * @brief Header at the start of a compiled word list (.hwl) file.
+ * The file is laid out as this header, then rowCount CompiledRow entries, then hintCount CompiledHint entries,
+ * then the word shape index (SHAPE_BUCKETS + 1 bucket starts and rowCount word indices, all uint32_t),
+ * then rowCount uint32_t letter masks, then a blob holding every word followed by every distinct hint.
+ * Fields are stored in the native byte order of the machine that compiled the list.
+ */
+struct CompiledHeader {
+    char magic[4];           // Always COMPILED_MAGIC.
+    uint32_t version;        // Always COMPILED_VERSION.
+    uint64_t rowCount;       // Number of entries in the offset table.
+    uint64_t hintCount;      // Number of entries in the hint table.
+    uint64_t blobSize;       // Size of the string blob in bytes.
+    uint64_t sourceSize;     // Size of the CSV the list was compiled from, used to detect a stale list.
+    int64_t sourceModified;  // Modification time of that CSV in nanoseconds, used to detect a stale list.
+};
+
+/**
+ * @struct CompiledRow
+ * @brief Fixed-width entry of a compiled word list's offset table.
+ */
+struct CompiledRow {
+    uint64_t offset;      // Offset of the word within the string blob.
+    uint32_t wordLength;  // Length of the word in bytes.
+    uint32_t hintId;      // Index of the word's hint in the hint table.
+};
+
+/**
+ * @struct CompiledHint
+ * @brief Fixed-width entry of a compiled word list's hint table.
+ */
+struct CompiledHint {
+    uint64_t offset;  // Offset of the hint within the string blob.
+    uint64_t length;  // Length of the hint in bytes.
+};
+
+const int SHAPE_MAX_LENGTH = 31;                                          // Longer words share the last length bucket.
+const int SHAPE_DISTINCT_LEVELS = 27;                                    // 0 to 26 distinct letters.
+const int SHAPE_BUCKETS = (SHAPE_MAX_LENGTH + 1) * SHAPE_DISTINCT_LEVELS;  // One bucket per (length, distinct letters) pair.
+static_assert(SHAPE_BUCKETS <= 65536, "Bucket numbers are stored as uint16_t");
+
+/**
+ * @struct WordShape
+ * @brief A range of word lengths and distinct-letter counts to select words from (bounds are inclusive).
+ */
+struct WordShape {
+    int minLength;    // Shortest word length accepted.
+    int maxLength;    // Longest word length accepted.
+    int minDistinct;  // Fewest distinct letters accepted.
+    int maxDistinct;  // Most distinct letters accepted.
+};
+
+/**
+ * @class WordShapeIndex
+ * @brief Groups the words of a list into buckets by length and distinct-letter count.
+ * The word indices are stored bucket by bucket (a counting sort), with each bucket's start offset alongside,
+ * so choosing a random word of a given shape only looks at the bucket counts, never at the words themselves.
+ * The arrays are either owned (built from a CSV list) or point into a mapped compiled list.
+ */
+class WordShapeIndex {
+   public:
+    WordShapeIndex() : starts(nullptr), order(nullptr), wordCount(0) {}
+    WordShapeIndex(WordShapeIndex&& other)
+        : ownedStarts(std::move(other.ownedStarts)),
+          ownedOrder(std::move(other.ownedOrder)),
+          starts(other.starts),
+          order(other.order),
+          wordCount(other.wordCount) {}
+    WordShapeIndex(const WordShapeIndex&) = delete;
+    WordShapeIndex& operator=(const WordShapeIndex&) = delete;
+
+    void build(const vector<uint16_t>& bucketOfWord);                // Builds owned arrays from each word's bucket number.
+    void attach(const uint32_t* bucketStarts, const uint32_t* wordOrder, size_t words);  // Uses arrays stored in a compiled list.
+    void clear();
+    bool empty() const { return starts == nullptr; }
+    size_t count(const WordShape& shape) const { return count(shape, 0, wordCount); }  // Number of words of the given shape.
+    size_t count(const WordShape& shape, size_t begin, size_t end) const;            // The same among words [begin, end), e.g. a shard.
+    size_t nth(const WordShape& shape, size_t ordinal) const { return nth(shape, 0, wordCount, ordinal); }  // Index of the ordinal-th word of the shape.
+    size_t nth(const WordShape& shape, size_t begin, size_t end, size_t ordinal) const;                    // The same among words [begin, end).
+    const uint32_t* bucketStarts() const { return starts; }          // SHAPE_BUCKETS + 1 offsets into wordOrder().
+    const uint32_t* wordOrder() const { return order; }             // Word indices grouped by bucket.
+    static int bucketOf(size_t length, int distinctLetters) {
+        return static_cast<int>(min<size_t>(length, SHAPE_MAX_LENGTH)) * SHAPE_DISTINCT_LEVELS + distinctLetters;
+    }
+
+   private:
+    void bucketRange(int bucket, size_t begin, size_t end, size_t& first, size_t& last) const;  // Positions in order of a bucket's words in [begin, end).
+    template <typename BucketVisitor>
+    void forEachBucket(const WordShape& shape, BucketVisitor visit) const {  // Visits the buckets of a shape until visit returns true.
+        if (empty()) {
+            return;
+        }
+        for (int length = max(shape.minLength, 0); length <= min(shape.maxLength, SHAPE_MAX_LENGTH); length++) {
+            for (int distinct = max(shape.minDistinct, 0); distinct <= min(shape.maxDistinct, SHAPE_DISTINCT_LEVELS - 1); distinct++) {
+                if (visit(bucketOf(length, distinct))) {
+                    return;
+                }
+            }
+        }
+    }
+
+    vector<uint32_t> ownedStarts;  // Storage for starts when built in memory.
+    vector<uint32_t> ownedOrder;   // Storage for order when built in memory.
+    const uint32_t* starts;        // Start of each bucket within order, plus the end of the last bucket.
+    const uint32_t* order;         // Word indices, grouped by bucket.
+    size_t wordCount;              // Number of words in the list; nth() never returns an index past it.
+};
+
+/**
+ * @struct LoadReport
+ * @brief What the normalization pass did to a freshly loaded word list.
+ */
+struct LoadReport {
+    size_t rows;        // Rows read before deduplication.
+    size_t duplicates;  // Rows dropped because their (normalized) word appeared earlier.
+    size_t empty;       // Rows dropped because their word was empty after trimming.
+    size_t rewritten;   // Words and distinct hints that had to be copied to be normalized (the rest are trimmed views).
+
+    LoadReport() : rows(0), duplicates(0), empty(0), rewritten(0) {}
+};
+
+/**
+ * @class WordSet
+ * @brief Open-addressing hash set of words with linear probing, used to drop duplicates while loading.
+ * The table is sized once for the expected number of words (at most half full), so it never rehashes.
+ */
+class WordSet {
+   public:
+    explicit WordSet(size_t expected);
+    bool insert(const StrView& word);  // Adds a word; false if it was already present.
+
+   private:
+    vector<StrView> slots;  // Empty slots have a null data pointer.
+    size_t mask;            // Table size minus one (the size is a power of two).
+};
+
+struct WordList;  // Defined below; a dictionary is built from one.
+
+/**
+ * @class FrontCodedDictionary
+ * @brief Compressed, self-contained copy of a word list for when memory matters more than O(1) access.
+ * The words are sorted and stored in blocks of FRONT_CODING_BLOCK words: the first word of a block is kept whole and
+ * each following word as the length of the prefix it shares with the previous word plus the rest of its letters.
+ * A block index gives the start of every block, so a word is decoded by replaying at most one block.
+ * Hints are interned once and referenced by id.
+ * Games address words by their load-order index (the shape index, letter masks, weights and shard ranges all do),
+ * so the dictionary also maps each load-order index to its sorted position. With --front-coded, every list gets one
+ * and rounds decode the word they play from it; --benchmark compares its size and pick cost with the other layouts.
+ */
+class FrontCodedDictionary {
+   public:
+    static const size_t FRONT_CODING_BLOCK = 16;  // Words per block; the first word of each block is stored whole.
+
+    FrontCodedDictionary() : count(0) {}
+    void build(const WordList& wordList);           // Sorts and compresses every word and hint of a list.
+    size_t size() const { return count; }
+    void word(size_t index, string& word) const;    // Decodes the index-th word (in sorted order) into word.
+    size_t position(size_t index) const { return positions[index]; }  // Sorted position of the word loaded index-th.
+    StrView hint(size_t index) const {
+        return StrView(hintText.data() + hintStarts[hintIds[index]], hintStarts[hintIds[index] + 1] - hintStarts[hintIds[index]]);
+    }
+    size_t memoryBytes() const;                     // Heap bytes used by the dictionary.
+
+   private:
+    size_t count;                  // Number of words.
+    vector<char> blob;             // Front-coded blocks of words.
+    vector<uint64_t> blockStarts;  // Offset of each block in blob.
+    vector<uint32_t> hintIds;      // Hint id of each word, in sorted order.
+    vector<uint32_t> positions;    // Sorted position of each word, in load order.
+    string hintText;               // The distinct hints, back to back.
+    vector<uint32_t> hintStarts;   // Offset of each hint in hintText, plus the end of the last one.
+};
+
+/**
+ * @struct WordList
+ * @brief The loaded word list, backed either by a parsed CSV file or by a compiled offset table.
+ * Both backings borrow from the mapped file, so the list is movable but not copyable.
+ */
+struct WordList {
+    MappedFile file;          // Mapping of the data file the views point into.
+    vector<WordView> words;   // One entry per "word,hint" row of a CSV file, in file order.
+    HintTable hints;          // Distinct hints, referenced by id from each word.
+    WordShapeIndex shapes;    // Words bucketed by length and distinct letters, for difficulty-aware selection.
+    vector<uint32_t> masks;   // Letters present in each word of a CSV list (see letterMask()).
+    const uint32_t* letterMasks;  // Letters present in each word, pointing into masks or a compiled list.
+    const CompiledRow* rows;  // Offset table of a compiled list (null when loaded from CSV).
+    const char* blob;         // String blob of a compiled list.
+    size_t blobSize;          // Size of the blob, which every compiled row is checked against when read.
+    size_t rowCount;          // Number of rows in a compiled list.
+    vector<MappedFile> shardFiles;  // Mappings of the shards of a sharded list, which its views point into.
+    vector<string> shardNames;      // Name of each shard (its file name without the extension); empty for other lists.
+    vector<size_t> shardStarts;     // Index of the first word of each shard, followed by size().
+    TextArena arena;                // Normalized copies of words and hints that were not already uppercase.
+    LoadReport report;              // Duplicates and rewrites found when the list was loaded.
+    unique_ptr<FrontCodedDictionary> dictionary;  // Front-coded copy that rounds play from (--front-coded); null otherwise.
+
+    WordList() : letterMasks(nullptr), rows(nullptr), blob(nullptr), blobSize(0), rowCount(0) {}
+    size_t size() const { return rows != nullptr ? rowCount : words.size(); }
+    bool empty() const { return size() == 0; }
+    StrView word(size_t index) const {  // Random access to a word in O(1) for either backing.
+        return rows != nullptr ? compiledWord(index) : StrView(words[index].word, words[index].wordLength);
+    }
+    uint32_t hintId(size_t index) const { return rows != nullptr ? compiledHintId(index) : words[index].hintId; }
+    StrView hint(size_t index) const { return hints.text(hintId(index)); }  // Resolves a word's hint text.
+    uint32_t letterMask(size_t index) const { return letterMasks[index]; }  // Precomputed letters of a word.
+    StrView playedWord(size_t index, string& decoded) const;  // The word a round plays; decoded from the dictionary when there is one.
+    StrView playedHint(size_t index) const;                   // The hint a round shows; read from the dictionary when there is one.
+    void buildMetadata();  // Fills masks and shapes from the words.
+    bool shardRange(const string& name, size_t& begin, size_t& end) const;  // Words [begin, end) come from the named shard.
+
+   private:
+    StrView compiledWord(size_t index) const;      // A compiled row's word; empty when its offsets leave the blob.
+    uint32_t compiledHintId(size_t index) const;   // A compiled row's hint id; 0 when it is out of range.
+};
+
+typedef shared_ptr<const WordList> WordListSnapshot;  // An immutable, shareable version of the word list.
+
+/**
+ * @struct EmbeddedWord
+ * @brief A word and hint of the list built into the binary, with their lengths known at compile time.
+ */
+struct EmbeddedWord {
+    const char* word;
+    uint32_t wordLength;
+    const char* hint;
+    uint32_t hintLength;
+};
+
+// The word list built into the binary: generated from src/data.csv by cmake/EmbedWordList.cmake, and empty when built without it.
+// The final entry is a terminator, so the array is never empty.
+constexpr EmbeddedWord EMBEDDED_WORDS[] = {
+#ifdef HANGMAN_HAVE_EMBEDDED_WORDS
+#define HANGMAN_EMBEDDED_WORD(word, hint) {word, sizeof(word) - 1, hint, sizeof(hint) - 1},
+#include "embedded_words.h"
+#undef HANGMAN_EMBEDDED_WORD
+#endif
+    {nullptr, 0, nullptr, 0}};
+constexpr size_t EMBEDDED_WORD_COUNT = sizeof(EMBEDDED_WORDS) / sizeof(EMBEDDED_WORDS[0]) - 1;
+
+/**
+ * @class RandomGenerator
+ * @brief A small, fast, seedable random number generator (PCG32: a 64-bit LCG with a permuted 32-bit output).
+ * Each session owns its own generator, so picks never share hidden state across threads, and a seed replays them exactly.
+ * Generators with the same seed and different streams produce independent sequences.
+ */
+class RandomGenerator {
+   public:
+    explicit RandomGenerator(uint64_t seed, uint64_t stream = 0);
+    uint32_t next();                  // The next 32 uniformly distributed bits.
+    uint32_t uniform(uint32_t bound);  // A uniform number in [0, bound), without modulo bias; bound must be at least 1.
+
+   private:
+    uint64_t state;      // Current state of the LCG.
+    uint64_t increment;  // Odd LCG increment selecting the stream.
+};
+
+/**
+ * @class AliasTable
+ * @brief Walker/Vose alias table for drawing indices in proportion to their weights in O(1) per draw.
+ * Each column holds a 32-bit acceptance threshold and an alias; a draw picks a column uniformly,
+ * then keeps it or takes its alias. Building the table is O(n), so weight changes should be applied in batches.
+ */
+class AliasTable {
+   public:
+    void build(const vector<double>& weights);  // Rebuilds the table; all-zero or empty weights give an empty table.
+    bool empty() const { return thresholds.empty(); }
+    size_t size() const { return thresholds.size(); }
+    size_t pick(RandomGenerator& random) const;  // Draws an index with probability proportional to its weight.
+
+   private:
+    vector<uint32_t> thresholds;  // Column i is kept when a 32-bit draw is below thresholds[i].
+    vector<uint32_t> aliases;     // Index taken when column i is not kept.
+};
+
+/**
+ * @struct WeightedWords
+ * @brief The selection weights of some of a list's words: those matching one difficulty's shape, or every word played.
+ * Weighted picks draw from the one matching the difficulty, so they keep the shape (and shard) restriction.
+ */
+struct WeightedWords {
+    WordShape shape;         // The difficulty shape the words match (unused for the table over every word played).
+    vector<uint32_t> words;  // Indices of the words; the alias table draws positions in this array.
+    AliasTable table;        // Alias table over words; empty when every one of them weighs 0.
+};
+
+/**
+ * @struct WordWeights
+ * @brief Selection weights for the words of one word list snapshot, loaded from the weights sidecar file.
+ * When games are limited to a shard, the weights only cover that shard's words.
+ * Immutable once published; a change to the sidecar builds and publishes a new WordWeights in one batch.
+ */
+struct WordWeights {
+    WordListSnapshot wordList;     // The snapshot these weights were built for, kept alive so its address cannot be reused by another list.
+    string shard;                  // The shard the weights were built for, or empty for the whole list.
+    WeightedWords all;             // Every word played: the shard's words, or the whole list.
+    vector<WeightedWords> shapes;  // The same restricted to each difficulty's shape, for the shapes matching any word played.
+
+    bool appliesTo(const WordList& list, const string& shardName) const { return wordList.get() == &list && shard == shardName; }
+    const WeightedWords* forShape(const WordShape& shape) const;  // The drawable weights for a shape, or null when there are none.
+};
+
+typedef shared_ptr<const WordWeights> WordWeightsSnapshot;  // An immutable, shareable version of the weights.
+
+/**
+ * @struct LoadProgress
+ * @brief Counters that a loading word list updates as it goes, so another thread can show how far it has got.
+ */
+struct LoadProgress {
+    atomic<uint64_t> rows;        // Rows parsed so far.
+    atomic<uint64_t> bytes;       // Bytes parsed so far.
+    atomic<uint64_t> totalBytes;  // Size of the file being parsed.
+
+    LoadProgress() : rows(0), bytes(0), totalBytes(0) {}
+    void reset() {
+        rows = 0;
+        bytes = 0;
+        totalBytes = 0;
+    }
+};
+
+/**
+ * @class WordListStore
+ * @brief Publishes the current word list as an immutable snapshot and rebuilds it when the data file changes.
+ * Readers take a snapshot once per game with snapshot() and keep it for the whole game, so a reload never
+ * changes a game in progress; the old list is freed when the last game holding it ends.
+ * A list parsed from the CSV borrows the file's bytes, so it is immutable except for the '#' tombstones that deleting
+ * or editing a word writes into its rows in place (see tombstoneRows()), which it sees until the reload replaces it.
+ * On Linux, watch() starts a background thread that uses inotify to reload the list whenever the CSV is rewritten.
+ * loadAsync() loads the first list on a worker thread, so the menu can be shown while a large list is parsed.
+ * Instead of one CSV, the list can come from shards: every CSV in a directory, or the files named by a manifest.
+ * With frontCoded, each list is published with a FrontCodedDictionary built from it.
+ */
+class WordListStore {
+   public:
+    WordListStore(const string& csvFilename, const string& compiledFilename, const string& weightsFilename, unsigned threadCount,
+                  const string& shardSource = "", const string& shardFilter = "", bool verbose = false, bool frontCoded = false)
+        : csvFilename(csvFilename),
+          compiledFilename(compiledFilename),
+          weightsFilename(weightsFilename),
+          shardSource(shardSource),
+          shardFilter(shardFilter),
+          verbose(verbose),
+          frontCoded(frontCoded),
+          threadCount(threadCount),
+          current(make_shared<const WordList>()),
+          stopping(false) {}
+    WordListStore(const WordListStore&) = delete;
+    WordListStore& operator=(const WordListStore&) = delete;
+    ~WordListStore() {
+        if (loading.valid()) {
+            loading.wait();
+        }
+        stopWatching();
+    }
+
+    WordListSnapshot snapshot() const { return atomic_load(&current); }  // The latest published list (never null).
+    WordWeightsSnapshot weights() const { return atomic_load(&currentWeights); }  // The latest weights (null when there is no sidecar).
+    bool reload();         // Loads the list (and its weights) from disk and publishes it; keeps the old snapshot on failure.
+    bool loadEmbedded();   // Publishes the word list built into the binary, without touching the disk.
+    void loadAsync();      // Starts reload() on a worker thread and returns immediately.
+    bool waitForLoad(chrono::milliseconds timeout) const;  // True once loadAsync() has finished (or was never started).
+    const LoadProgress& progress() const { return loadProgress; }  // Progress of the running (or last) load.
+    const string& shard() const { return shardFilter; }  // The shard games pick from; empty for every shard.
+    string takeMessages() const;  // Returns and clears the notes of loads since the last call, for the main thread to print.
+    void reloadWeights();  // Rebuilds the weights for the current list from the sidecar and publishes them.
+    bool watch();          // Starts reloading in the background whenever the CSV or the weights sidecar changes.
+    void stopWatching();   // Stops the background watcher, if running.
+
+   private:
+    void watchLoop(int inotifyFd, int listWatch, int weightsWatch);
+    void publishWeights();                        // reloadWeights() for a caller already holding reloading.
+    string listDirectory() const;                 // The directory holding the CSV, the shards, or the shard manifest.
+    bool isListFile(const string& name) const;    // Whether a file in listDirectory() is part of the list.
+
+    string csvFilename;                 // The CSV word list to load and watch.
+    string compiledFilename;            // Compiled list preferred over the CSV while it is up to date.
+    string weightsFilename;             // Optional "word,weight" sidecar giving selection weights.
+    string shardSource;                 // Directory or manifest of shards to load instead of the CSV; empty for the CSV.
+    string shardFilter;                 // Shard that games pick words from; empty for every shard.
+    bool verbose;                       // Print load timings (per shard for sharded lists).
+    bool frontCoded;                    // Give every list a front-coded dictionary that rounds play from.
+    unsigned threadCount;               // Number of threads used to parse the CSV.
+    WordListSnapshot current;           // Published snapshot; only accessed atomically.
+    WordWeightsSnapshot currentWeights;  // Published weights; only accessed atomically.
+    atomic<bool> stopping;              // Set to ask the watcher thread to exit.
+    thread watcher;                     // Background thread running watchLoop().
+    mutex reloading;                    // Serializes loads, so lists are published in the order the files were read.
+    mutable mutex messagesLock;         // Guards messages.
+    mutable string messages;            // Load notes (timings, fallbacks) waiting to be printed by takeMessages()'s caller.
+    LoadProgress loadProgress;          // Updated while a list is parsed.
+    shared_future<bool> loading;        // Result of the load started by loadAsync().
+};
+
+/**
+ * @class WordScheduler
+ * @brief A shuffle bag of word positions: hands out every position once, in random order, before any repeats.
+ * Each draw performs one step of a Fisher-Yates shuffle, so picks are O(1) and the permutation is built lazily.
+ * Slots hold 32-bit positions stored as position + 1, with 0 meaning "not yet swapped" (the slot holds its own index),
+ * so a fresh bag is just a zero-filled array. Each session (or player) owns its own bag, and the bag owns the session's generator.
  */
-struct WordItem {
-    string word;  // The word to be guessed
-    string hint;  // A hint to help the player guess the word
+class WordScheduler {
+   public:
+    explicit WordScheduler(const RandomGenerator& random) : random(random), cursor(0), lastWord(SIZE_MAX) {}
+    size_t next(size_t count);  // Draws the next position in [0, count); starts a new bag when exhausted or when count changes.
+    RandomGenerator& generator() { return random; }  // The session's generator, for picks made outside the bag.
+    size_t previous() const { return lastWord; }     // The word chosen last for this session, or SIZE_MAX before the first.
+    void remember(size_t word) { lastWord = word; }  // Records the word just chosen, so weighted picks can avoid repeating it.
+
+   private:
+    RandomGenerator random;  // Source of the session's picks.
+    vector<uint32_t> slots;  // The permutation in progress; slots before cursor have been handed out.
+    size_t cursor;           // Number of positions drawn from the current bag.
+    size_t lastWord;         // The word chosen last, see remember().
 };
 
 /**
@@ -72,19 +718,87 @@ struct WordItem {
  */
 struct GameState {
     string chosenWord;                                              // Currently selected word for the player to guess.
-    string guessedLetters;                                          // Cumulative string of letters guessed by the player.
-    string chosenHint;                                              // Hint associated with the chosen word to aid guessing.
+    array<char, 26> guessOrder = {};                                // Letters guessed by the player, in the order they were guessed (display only).
+    int guessCount = 0;                                             // Number of letters in guessOrder.
+    StrView chosenHint;                                             // Hint associated with the chosen word, resolved from the hint table when displayed.
     int incorrectGuesses = 0;                                       // Count of the player's incorrect guesses, affecting game progression.
     int maxGuesses;                                                 // Configurable maximum number of incorrect guesses before game over.
     bool wordGuessed = false;                                       // Indicator whether the chosen word has been completely guessed.
-    int wonRounds = 0;                                              // Number of rounds won by the player.
-    int lostRounds = 0;                                             // Number of rounds lost by the player.
-    int totalRounds = 0;                                            // Total number of rounds played by the player.
-    double winRate = 0.0;                                           // Percentage of rounds won by the player.
-    double lossRate = 0.0;                                          // Percentage of rounds lost by the player.
+    uint32_t wordMask = 0;                                          // Letters present in the chosen word, one bit per letter (see letterMask()).
+    uint32_t guessedMask = 0;                                       // Letters guessed so far, one bit per letter.
+    uint32_t remainingMask = 0;                                     // Letters of the word not revealed yet; the word is solved when it is 0.
     explicit GameState(int maxGuesses) : maxGuesses(maxGuesses) {}  // Initializes the game state with a specific difficulty level. (max incorrect guesses allowed)
 };
 
+/**
+ * @struct GuessEvent
+ * @brief The outcome of one guess, returned by the engine so front-ends can report it however they like.
+ */
+struct GuessEvent {
+    GuessResult result;  // What the guess did.
+    GameStatus status;   // The game's status after the guess.
+    uint32_t revealed;   // Letters of the word revealed by this guess, one bit per letter.
+    int guessesLeft;     // Incorrect guesses remaining after this guess.
+};
+
+/**
+ * @struct GameSession
+ * @brief A game in 16 bytes, for servers and benchmarks that keep millions of games resident.
+ * Unlike GameState it refers to its word by index into a word list instead of copying it, and leaves statistics to PlayerStats.
+ * It is plain data: no constructor, no heap, and safe to copy with memcpy; start each game with newGame().
+ */
+struct GameSession {
+    uint32_t wordId;            // Index of the word in the word list the game was started from.
+    uint32_t guessedMask;       // Letters guessed so far, one bit per letter.
+    uint32_t remainingMask;     // Letters of the word not revealed yet; the word is solved when it is 0.
+    uint8_t incorrectGuesses;   // Incorrect guesses made so far.
+    uint8_t maxGuesses;         // Incorrect guesses allowed before the game is lost.
+    uint8_t status;             // The game's GameStatus.
+    uint8_t reserved;           // Unused; kept zero.
+};
+
+static_assert(sizeof(GameSession) == 16, "GameSession must stay 16 bytes");
+
+/**
+ * @struct PlayerStats
+ * @brief A player's record across games, kept apart from the state of any one game.
+ */
+struct PlayerStats {
+    uint32_t wonRounds = 0;   // Number of rounds won by the player.
+    uint32_t lostRounds = 0;  // Number of rounds lost by the player.
+
+    uint32_t totalRounds() const { return wonRounds + lostRounds; }
+    double winRate() const { return totalRounds() == 0 ? 0.0 : static_cast<double>(wonRounds) / totalRounds() * 100.0; }     // Percentage of rounds won.
+    double lossRate() const { return totalRounds() == 0 ? 0.0 : static_cast<double>(lostRounds) / totalRounds() * 100.0; }  // Percentage of rounds lost.
+};
+
+typedef uint32_t SessionId;  // Index of a game in a SessionTable.
+
+/**
+ * @class SessionTable
+ * @brief Many compact games stored as parallel arrays, one per GameSession field, so a batch of guesses is applied in one pass.
+ * applyGuesses() updates each game without branching on the outcome, touching only the fields a guess needs.
+ */
+class SessionTable {
+   public:
+    void resize(size_t count);  // Grows or shrinks the table; new games are over (GAME_LOST) until started with newGame().
+    size_t size() const { return wordIds.size(); }
+    void newGame(SessionId id, const WordList& wordList, uint32_t wordId, int maxGuesses);  // Same as newGame() on a GameSession.
+    void applyGuesses(const SessionId* ids, const char* letters, size_t count);           // Game ids[i] guesses letters[i], in order.
+    GameStatus status(SessionId id) const { return static_cast<GameStatus>(statuses[id]); }
+    GameSession session(SessionId id) const;  // Copies a game out of the table.
+
+   private:
+    void applyGuess(SessionId id, char letter);                               // One guess of applyGuesses().
+
+    vector<uint32_t> wordIds;          // Index of each game's word in its word list.
+    vector<uint32_t> guessedMasks;     // Letters guessed so far in each game.
+    vector<uint32_t> remainingMasks;   // Letters not revealed yet in each game.
+    vector<uint8_t> incorrectGuesses;  // Incorrect guesses made so far in each game.
+    vector<uint8_t> maxGuesses;        // Incorrect guesses allowed in each game.
+    vector<uint8_t> statuses;          // GameStatus of each game.
+};
+
 /**
  * @brief wrapper struct for player state
  * Manages the state and statistics of a player in the game.
@@ -93,48 +807,194 @@ struct GameState {
 struct PlayerState {
     GameState state;
     string playerName;
-    int totalWins = 0;    // Total wins across multiple games
-    int totalLosses = 0;  // Total losses across multiple games
+    PlayerStats stats;  // Wins and losses across multiple games
 
     PlayerState(const GameState& state, const string& playerName) : state(state), playerName(playerName){};  // Constructor to initialize the player state
 };
 
+/**
+ * @struct Options
+ * @brief Settings taken from the command line.
+ * Selects the tool to run (compile, benchmark, or the game itself) and how the word list is loaded.
+ */
+struct Options {
+    unsigned threads;       // Number of threads used to parse a CSV word list (--threads N).
+    string compileSource;   // CSV to compile (--compile <csv> <hwl>); empty when not compiling.
+    string compileTarget;   // Compiled list to write with --compile.
+    string benchmarkFile;   // CSV to benchmark the parser on (--benchmark <csv>); empty when not benchmarking.
+    bool selfTest;          // Run the built-in checks and exit (--self-test).
+    bool quick;             // Play one singleplayer game without loading the whole word list (--quick).
+    bool embedded;          // Play from the word list built into the binary, without any file access (--embedded).
+    string shards;          // Directory or manifest of word list shards to load instead of data.csv (--shards <path>).
+    string shard;           // Only pick words from the shard with this name (--shard <name>).
+    bool verbose;           // Print word list load timings, per shard (--verbose).
+    bool frontCoded;        // Play rounds from a front-coded copy of the word list (--front-coded).
+    uint64_t seed;          // Seed of every word pick (--seed N); taken from the clock unless given.
+
+    Options()
+        : threads(max(1u, thread::hardware_concurrency())),
+          selfTest(false),
+          quick(false),
+          embedded(false),
+          verbose(false),
+          frontCoded(false),
+          seed(static_cast<uint64_t>(chrono::system_clock::now().time_since_epoch().count())) {}
+};
+
+/**
+ * @struct DelimiterMasks
+ * @brief Positions of the commas and newlines in a 64-byte block of a CSV file.
+ * Bit i of each mask is set when byte i of the block is that delimiter.
+ */
+struct DelimiterMasks {
+    uint64_t commas;    // Bitmap of ',' bytes.
+    uint64_t newlines;  // Bitmap of '\n' bytes.
+};
+
+typedef DelimiterMasks (*DelimiterScanner)(const char* block);  // Scans exactly 64 bytes starting at block.
+
+// Applies one guess to each of count consecutive games of a SessionTable, given pointers to the first game's fields.
+typedef void (*GuessRunApplier)(uint32_t* guessed, uint32_t* remaining, uint8_t* incorrect, const uint8_t* allowed, uint8_t* status,
+                                const char* letters, size_t count);
+
 // =========== FUNCTION PROTOTYPES ============ //
 
 GameMode modeMenu();
 void clearScreen();
 char getValidatedInput(const string& prompt, const string& validOptions);
-void displayWords(const string& filename);
+void displayWords(const string& filename, WordListIndex& index);
+void searchWords(const string& filename, WordListIndex& index);
 void appendWord(const string& filename);
-void readIntoWordItem(vector<WordItem>& wordList, const string& filename);
+bool parseOptions(int argc, char* argv[], Options& options);
+void runParseBenchmark(const string& filename);
+void runDictionaryBenchmark(const string& filename, uint64_t seed);
+void runSessionBenchmark(const string& filename, uint64_t seed);
+void runBatchGuessBenchmark(const WordList& wordList, RandomGenerator& random);
+bool runSelfTest();
+bool selfTestParser();
+bool selfTestShapes();
+void readRowsWithGetline(const string& text, vector<pair<string, string>>& rows);
+void appendVarint(vector<char>& bytes, uint32_t value);
+uint32_t readVarint(const char*& position);
+DelimiterMasks scanDelimitersScalar(const char* block);
+#if defined(HANGMAN_HAVE_X86_SIMD) && defined(__SSE2__)
+DelimiterMasks scanDelimitersSse2(const char* block);
+#endif
+#ifdef HANGMAN_HAVE_X86_SIMD
+DelimiterMasks scanDelimitersAvx2(const char* block);
+#endif
+DelimiterScanner selectDelimiterScanner(const char*& name);
+template <typename RowHandler>
+void forEachRow(const char* begin, const char* end, RowHandler& handleRow);
+void parseWordList(vector<WordView>& words, HintTable& hints, const char* begin, const char* end, LoadProgress* progress = nullptr);
+void parseWordListParallel(vector<WordView>& words, HintTable& hints, const char* begin, const char* end, unsigned threadCount,
+                           LoadProgress* progress = nullptr);
+bool loadWordList(WordList& wordList, const string& filename, unsigned threadCount = 1, LoadProgress* progress = nullptr);
+bool fileSignature(const string& filename, uint64_t& size, int64_t& modified);
+bool compileWordList(const string& csvFilename, const string& compiledFilename, unsigned threadCount);
+bool loadCompiledWordList(WordList& wordList, const string& compiledFilename, const string& csvFilename);
+bool compiledTablesValid(const CompiledHeader& header, const char* hintTable, const uint32_t* bucketStarts);
+bool loadEmbeddedWordList(WordList& wordList);
+bool listShards(const string& source, vector<string>& shardFilenames);
+bool loadShardedWordList(WordList& wordList, const vector<string>& shardFilenames, LoadProgress* progress, string& timings);
+bool isDirectory(const string& path);
+string fileDirectory(const string& path);
+bool loadWordWeights(WordWeights& weights, const WordListSnapshot& snapshot, const string& filename, const string& shard, string& notes);
+bool pickRandomRow(const string& filename, RandomGenerator& random, string& word, string& hint);
+bool pickRandomWord(const string& compiledFilename, const string& csvFilename, RandomGenerator& random, string& word, string& hint);
 void manageWordList(const string& filename);
-void gameStats(GameState& state);
+bool importWords(const string& filename, const string& sourceFilename);
+bool findWordRows(const string& filename, const string& word, vector<uint64_t>& offsets, size_t& rowCount, size_t& tombstoneCount);
+bool tombstoneRows(const string& filename, const vector<uint64_t>& offsets);
+bool compactWordList(const string& filename);
+#ifdef HANGMAN_HAVE_MMAP
+bool writeAll(int fd, const char* data, size_t size);
+bool syncDirectory(const string& path);
+#endif
+bool deleteWord(const string& filename);
+bool editWord(const string& filename);
+bool isValidWord(const string& word);
 void convertToUpper(string& str);
+void normalizeText(string& text);
+bool matchesNormalized(const StrView& text, const StrView& normalized);
+StrView trimView(const StrView& text);
+StrView normalizeView(const StrView& text, TextArena& arena, size_t& rewritten);
+void normalizeWordList(WordList& wordList);
+uint32_t letterMask(const StrView& word);
+uint32_t letterBit(char letter);
+inline int countBits(uint32_t mask);
 int selectDifficultyLevel();
+WordShape difficultyWordShape(int maxGuesses);
+size_t scheduleWord(const WordList& wordList, const WordWeights* weights, const WordShape& shape, const string& shard, WordScheduler& scheduler);
+size_t pickWeightedWord(const WordWeights& weights, const WordShape& shape, WordScheduler& scheduler);
+string fileBaseName(const string& path);
+void newGame(GameState& state, const StrView& word, const StrView& hint, int maxGuesses);
+void newGame(GameState& state, const StrView& word, const StrView& hint, int maxGuesses, uint32_t wordMask);
+GuessEvent guessLetter(GameState& state, char letter);
+GuessEvent guessWord(GameState& state, const StrView& word);
+GameStatus gameStatus(const GameState& state);
+void newGame(GameSession& session, const WordList& wordList, uint32_t wordId, int maxGuesses);
+GuessEvent guessLetter(GameSession& session, char letter);
+GuessEvent guessWord(GameSession& session, const WordList& wordList, const StrView& word);
+GameStatus gameStatus(const GameSession& session);
+void recordGameResult(PlayerStats& stats, GameStatus status);
+void applyGuessRunScalar(uint32_t* guessed, uint32_t* remaining, uint8_t* incorrect, const uint8_t* allowed, uint8_t* status, const char* letters,
+                         size_t count);
+GuessRunApplier selectGuessRunApplier();
 void setupDifficulty(int& maxGuesses);
 void displayGameState(const GameState& state);
 bool wordGuess(GameState& state, const string& fullGuess);
 bool handleCharacterGuess(GameState& state, char guess);
 bool processPlayerGuess(GameState& state);
-bool checkWordGuessed(GameState& state);
 void drawGallows(int incorrect, int maxGuesses);
-void endGameDisplay(GameState& state);
+void endGameDisplay(const GameState& state, PlayerStats& stats);
 bool promptToPlayAgain();
-void playSingleplayer(const vector<WordItem>& wordList);
+void waitForWordList(const WordListStore& wordStore);
+void playSingleplayer(const WordListStore& wordStore, const RandomGenerator& random);
+void playQuickSingleplayer(const string& compiledFilename, const string& csvFilename, RandomGenerator random);
 void playInteractiveMultiplayer();
-void multiplayerSetup(GameState& state1, GameState& state2, const vector<WordItem>& wordList);
+void multiplayerSetup(GameState& state1, GameState& state2, const WordList& wordList, const WordWeights* weights, const string& shard,
+                      WordScheduler& scheduler);
 void multiplayerEndGameDisplay(PlayerState& playerState);
 void printMultiplayerStats(const PlayerState& player1, const PlayerState& state2);
-void playMultiplayer(const vector<WordItem>& wordList);
-void playGame(const vector<WordItem>& wordList);
+void playMultiplayer(const WordListStore& wordStore, const RandomGenerator& random);
+void playGame(const WordListStore& wordStore, uint64_t seed);
 
 // =========== MAIN ============ //
 
-int main() {
-    srand(time(nullptr));  // Seed the random number generator.
-    vector<WordItem> wordList;
-    readIntoWordItem(wordList, "data.csv");
-    playGame(wordList);
+int main(int argc, char* argv[]) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        return 1;
+    }
+    if (!options.compileSource.empty()) {
+        return compileWordList(options.compileSource, options.compileTarget, options.threads) ? 0 : 1;
+    }
+    if (options.selfTest) {
+        return runSelfTest() ? 0 : 1;
+    }
+    if (!options.benchmarkFile.empty()) {
+        runParseBenchmark(options.benchmarkFile);
+        runDictionaryBenchmark(options.benchmarkFile, options.seed);
+        runSessionBenchmark(options.benchmarkFile, options.seed);
+        return 0;
+    }
+    if (options.verbose) {
+        cout << "Random seed: " << options.seed << " (replay with --seed " << options.seed << ")" << endl;
+    }
+    if (options.quick) {
+        playQuickSingleplayer("data.hwl", "data.csv", RandomGenerator(options.seed));
+        return 0;
+    }
+    WordListStore wordStore("data.csv", "data.hwl", "data.weights", options.threads, options.shards, options.shard, options.verbose,
+                            options.frontCoded);
+    if (options.embedded) {
+        wordStore.loadEmbedded();  // No file access at all: no list, weights, or watcher
+    } else {
+        wordStore.loadAsync();  // The menu is shown while the list loads; games wait for it in waitForWordList().
+        wordStore.watch();      // Words added while playing become available without a restart.
+    }
+    playGame(wordStore, options.seed);
     return 0;
 }
 
@@ -176,175 +1036,3449 @@ void clearInputBuffer() {
 }
 
 /**
- * @brief Prints a series of newline characters to clear the console screen, improving readability for the user.
- * This function is used to maintain a clean and clear interface before showing new output to the user.
+ * @brief Prints a series of newline characters to clear the console screen, improving readability for the user.
+ * This function is used to maintain a clean and clear interface before showing new output to the user.
+ */
+void clearScreen() {
+    // Clear the screen by printing enough newlines.
+    cout << string(100, '\n');
+}
+
+/**
+ * @brief Converts a given string to uppercase to standardize user input and facilitate case-insensitive comparisons.
+ * Range-based for loop is used to iterate over an unknown number of characters, a nifty feature of C++11 to simplify string manipulation.
+ * @param str The string to be converted to uppercase. The conversion is done in-place using a reference to avoid unnecessary copying.
+ */
+void convertToUpper(string& str) {
+    for (char& c : str) {
+        c = toupper(c);
+    }
+}
+
+/**
+ * @brief Normalizes a word or hint the way the word list loader does: surrounding whitespace (including '\r') is trimmed
+ * and letters are uppercased. Used for words that do not come from a loaded list.
+ * @param text The text to normalize in place.
+ */
+void normalizeText(string& text) {
+    StrView trimmed = trimView(StrView(text.data(), text.size()));
+    text = string(trimmed.data, trimmed.size);
+    convertToUpper(text);
+}
+
+/**
+ * @brief Tells whether a raw word or hint, as stored in a file, normalizes (see normalizeText()) to the given text.
+ * @param text The raw text.
+ * @param normalized The normalized text to compare with.
+ * @return True if they match, false otherwise.
+ */
+bool matchesNormalized(const StrView& text, const StrView& normalized) {
+    StrView trimmed = trimView(text);
+    if (trimmed.size != normalized.size) {
+        return false;
+    }
+    for (size_t i = 0; i < trimmed.size; i++) {
+        if (toupper(static_cast<unsigned char>(trimmed.data[i])) != static_cast<unsigned char>(normalized.data[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Creates a generator; the same seed and stream always produce the same sequence.
+ * @param seed The starting point of the sequence.
+ * @param stream Selects one of 2^63 independent sequences, e.g. one per session.
+ */
+RandomGenerator::RandomGenerator(uint64_t seed, uint64_t stream) : state(0), increment((stream << 1) | 1) {
+    next();
+    state += seed;
+    next();
+}
+
+/**
+ * @brief Advances the generator and returns its next output.
+ * @return 32 uniformly distributed bits.
+ */
+uint32_t RandomGenerator::next() {
+    uint64_t previous = state;
+    state = previous * 6364136223846793005ULL + increment;
+    uint32_t xorShifted = static_cast<uint32_t>(((previous >> 18) ^ previous) >> 27);
+    uint32_t rotation = static_cast<uint32_t>(previous >> 59);
+    return (xorShifted >> rotation) | (xorShifted << ((32 - rotation) & 31));
+}
+
+/**
+ * @brief Returns a uniformly distributed number in [0, bound), without the modulo bias of next() % bound.
+ * Scales a 32-bit draw by bound with one multiplication and rejects the few draws that would favor some results.
+ * @param bound The exclusive upper bound; must be at least 1.
+ * @return The random number.
+ */
+uint32_t RandomGenerator::uniform(uint32_t bound) {
+    uint64_t product = static_cast<uint64_t>(next()) * bound;
+    uint32_t low = static_cast<uint32_t>(product);
+    if (low < bound) {
+        uint32_t threshold = (0u - bound) % bound;  // 2^32 mod bound: the number of draws to reject.
+        while (low < threshold) {
+            product = static_cast<uint64_t>(next()) * bound;
+            low = static_cast<uint32_t>(product);
+        }
+    }
+    return static_cast<uint32_t>(product >> 32);
+}
+
+/**
+ * @brief Returns the file name part of a path (everything after the last '/').
+ * @param path The path to split.
+ * @return The file name.
+ */
+string fileBaseName(const string& path) {
+    size_t slash = path.find_last_of('/');
+    return (slash == string::npos) ? path : path.substr(slash + 1);
+}
+
+/**
+ * @brief Returns the directory part of a path (everything before the last '/'), or "." for a bare file name.
+ * @param path The path to split.
+ * @return The directory.
+ */
+string fileDirectory(const string& path) {
+    size_t slash = path.find_last_of('/');
+    if (slash == string::npos) {
+        return ".";
+    }
+    return (slash == 0) ? "/" : path.substr(0, slash);
+}
+
+/**
+ * @brief Tells whether a path names a directory.
+ * @param path The path to check.
+ * @return True if the path exists and is a directory, false otherwise.
+ */
+bool isDirectory(const string& path) {
+    struct stat info;
+    return stat(path.c_str(), &info) == 0 && S_ISDIR(info.st_mode);
+}
+
+/**
+ * @brief Prompts the user for a single character input and validates it against a string of acceptable characters.
+ * Repeatedly prompts until a valid character is entered, which is then returned as the user's choice.
+ * @param prompt The message displayed to the user asking for input.
+ * @param validOptions A string containing all acceptable characters for input validation.
+ * @return The validated character input by the user.
+ */
+char getValidatedInput(const string& prompt, const string& validOptions) {
+    string input;
+    cout << prompt;
+    while (true) {
+        getline(cin, input);  // Using getline to handle full strings
+
+        if (isdigit(input[0]) && validOptions.find(input[0]) != string::npos) {
+            return input[0];  // If the input is a number and is not the end of a string, return it.
+        }
+        if (input.length() == 1 && (validOptions.find(toupper(input[0])) != string::npos || input[0] == '1')) {
+            return toupper(input[0]);  // If the input is a single character and in the valid options, return it.
+        } else {                       // If the input is invalid, prompt the user again.
+            cout << "Invalid response.\nPlease enter only one of\n [" << validOptions << "]\nor '1' to guess the entire word.\n>>> ";
+        }
+    }
+}
+
+// =========== COMMAND LINE FUNCTIONS ============ //
+
+/**
+ * @brief Parses the command-line arguments into an Options struct.
+ * Recognized arguments are --threads N, --compile <csv> <hwl>, --benchmark <csv>, --self-test, --quick, --embedded, --shards <path>,
+ * --shard <name>, --verbose, --front-coded, and --seed N.
+ * @param argc The number of arguments, as passed to main().
+ * @param argv The arguments, as passed to main().
+ * @param options The options to fill; fields not named on the command line keep their defaults.
+ * @return True if all arguments were valid, false (after printing usage) otherwise.
+ */
+bool parseOptions(int argc, char* argv[], Options& options) {
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        if (arg == "--threads" && i + 1 < argc && atoi(argv[i + 1]) > 0) {
+            options.threads = static_cast<unsigned>(atoi(argv[++i]));
+        } else if (arg == "--compile" && i + 2 < argc) {
+            options.compileSource = argv[++i];
+            options.compileTarget = argv[++i];
+        } else if (arg == "--benchmark" && i + 1 < argc) {
+            options.benchmarkFile = argv[++i];
+        } else if (arg == "--self-test") {
+            options.selfTest = true;
+        } else if (arg == "--quick") {
+            options.quick = true;
+        } else if (arg == "--embedded") {
+            options.embedded = true;
+        } else if (arg == "--shards" && i + 1 < argc) {
+            options.shards = argv[++i];
+        } else if (arg == "--shard" && i + 1 < argc) {
+            options.shard = argv[++i];
+        } else if (arg == "--verbose") {
+            options.verbose = true;
+        } else if (arg == "--front-coded") {
+            options.frontCoded = true;
+        } else if (arg == "--seed" && i + 1 < argc && isdigit(static_cast<unsigned char>(argv[i + 1][0]))) {
+            options.seed = strtoull(argv[++i], nullptr, 10);
+        } else {
+            cerr << "Unknown or incomplete argument: " << arg << "\n"
+                 << "Usage: " << argv[0] << " [--threads N] [--compile <csv> <hwl>] [--benchmark <csv>] [--self-test] [--quick] [--embedded]"
+                 << " [--shards <dir|manifest>] [--shard <name>] [--verbose] [--front-coded] [--seed N]" << endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Times the CSV parser on a file with 1 to 32 threads and prints the throughput and speedup of each run.
+ * The file is mapped once up front so that only parsing is measured; each thread count keeps its best of three runs.
+ * @param filename The path to the CSV file to parse.
+ */
+void runParseBenchmark(const string& filename) {
+    MappedFile file;
+    if (!file.open(filename)) {
+        cerr << "Failed to open file: " << filename << endl;
+        return;
+    }
+    const char* begin = file.data();
+    const char* end = begin + file.size();
+    vector<WordView> warmup;  // Fault the mapping in so the first timed run is not penalized.
+    HintTable warmupHints;
+    parseWordList(warmup, warmupHints, begin, end);
+    const char* scannerName;
+    selectDelimiterScanner(scannerName);
+    cout << "Parsing " << file.size() << " bytes (" << warmup.size() << " words, " << warmupHints.size() << " distinct hints) from " << filename
+         << " with the " << scannerName << " scanner\n";
+    cout << "Word index: " << warmup.size() * sizeof(WordView) << " bytes\n";
+    cout << "threads\tms\tMB/s\tspeedup\n";
+
+    double baseline = 0.0;
+    for (unsigned threads = 1; threads <= 32; threads *= 2) {
+        double best = numeric_limits<double>::max();
+        for (int run = 0; run < 3; run++) {
+            vector<WordView> words;
+            HintTable hints;
+            chrono::steady_clock::time_point start = chrono::steady_clock::now();
+            parseWordListParallel(words, hints, begin, end, threads);
+            chrono::duration<double, milli> elapsed = chrono::steady_clock::now() - start;
+            best = min(best, elapsed.count());
+        }
+        if (threads == 1) {
+            baseline = best;
+        }
+        cout << threads << "\t" << best << "\t" << (file.size() / 1e6) / (best / 1e3) << "\t" << baseline / best << "\n";
+    }
+    cout.flush();
+}
+
+/**
+ * @brief Compares the memory use and pick latency of three in-memory word lists built from the same file:
+ * a vector of (word, hint) string pairs (the layout the game used to load), the WordList views into the mapped file,
+ * and the front-coded dictionary. A pick copies a random word into a string, as starting a round does.
+ * @param filename The path to the CSV file to load.
+ * @param seed The seed of the random picks.
+ */
+void runDictionaryBenchmark(const string& filename, uint64_t seed) {
+    const size_t PICKS = 1000000;  // Random picks timed per representation
+    RandomGenerator random(seed);
+    WordList wordList;
+    if (!loadWordList(wordList, filename)) {
+        return;
+    }
+    if (wordList.empty()) {
+        cerr << "No words to benchmark in: " << filename << endl;
+        return;
+    }
+    vector<pair<string, string>> items;
+    items.reserve(wordList.size());
+    size_t itemBytes = items.capacity() * sizeof(pair<string, string>);
+    for (size_t i = 0; i < wordList.size(); i++) {
+        items.push_back(make_pair(wordList.word(i).str(), wordList.hint(i).str()));
+        for (const string* text : {&items.back().first, &items.back().second}) {
+            itemBytes += (text->capacity() > string().capacity()) ? text->capacity() + 1 : 0;  // Heap buffer beyond the inline one
+        }
+    }
+    size_t viewBytes = wordList.size() * sizeof(WordView) + wordList.hints.size() * sizeof(StrView);
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    FrontCodedDictionary dictionary;
+    dictionary.build(wordList);
+    chrono::duration<double, milli> buildTime = chrono::steady_clock::now() - start;
+
+    vector<size_t> picks(PICKS);
+    for (size_t& pick : picks) {
+        pick = random.uniform(static_cast<uint32_t>(wordList.size()));
+    }
+    string word;
+    size_t checksum = 0;  // Keeps the picks from being optimized away.
+    auto timePicks = [&](const function<void(size_t)>& pickWord) {
+        chrono::steady_clock::time_point begin = chrono::steady_clock::now();
+        for (size_t pick : picks) {
+            pickWord(pick);
+            checksum += word.size();
+        }
+        chrono::duration<double, nano> elapsed = chrono::steady_clock::now() - begin;
+        return elapsed.count() / PICKS;
+    };
+    double itemPick = timePicks([&](size_t i) { word = items[i].first; });
+    double viewPick = timePicks([&](size_t i) { word.assign(wordList.word(i).data, wordList.word(i).size); });
+    double dictionaryPick = timePicks([&](size_t i) { dictionary.word(dictionary.position(i), word); });
+
+    cout << "\nIn-memory word lists (" << wordList.size() << " words, front coding built in " << buildTime.count() << " ms)\n";
+    cout << "layout\tbytes\tbytes/word\tns/pick\n";
+    cout << "strings\t" << itemBytes << "\t" << static_cast<double>(itemBytes) / wordList.size() << "\t" << itemPick << "\n";
+    cout << "views\t" << viewBytes << "\t" << static_cast<double>(viewBytes) / wordList.size() << "\t" << viewPick
+         << "\t(plus the " << wordList.file.size() << "-byte mapped file)\n";
+    cout << "front\t" << dictionary.memoryBytes() << "\t" << static_cast<double>(dictionary.memoryBytes()) / wordList.size() << "\t"
+         << dictionaryPick << "\n";
+    cout << "(checksum " << checksum << ")" << endl;
+}
+
+/**
+ * @brief Starts ten million compact games on random words of a file and plays them all to the end,
+ * printing the memory they take next to what the same games would take as GameStates.
+ * Each pass guesses one letter in every game still in progress, in English letter frequency order.
+ * @param filename The path to the CSV file to load.
+ * @param seed The seed of the word picks.
+ */
+void runSessionBenchmark(const string& filename, uint64_t seed) {
+    const size_t SESSIONS = 10000000;                   // Resident games
+    const int MAX_GUESSES = 8;                          // Noob difficulty
+    const char* LETTER_ORDER = "ETAOINSHRDLCUMWFGYPBVKJXQZ";  // Most frequent letters first
+    RandomGenerator random(seed);
+    WordList wordList;
+    if (!loadWordList(wordList, filename)) {
+        return;
+    }
+    if (wordList.empty()) {
+        cerr << "No words to benchmark in: " << filename << endl;
+        return;
+    }
+
+    vector<GameSession> sessions(SESSIONS);
+    size_t stateBytes = SESSIONS * sizeof(GameState);  // The same games as GameStates, including word copies beyond the inline buffer
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    for (GameSession& session : sessions) {
+        newGame(session, wordList, random.uniform(static_cast<uint32_t>(wordList.size())), MAX_GUESSES);
+        size_t wordLength = wordList.word(session.wordId).size;
+        stateBytes += (wordLength > string().capacity()) ? wordLength + 1 : 0;
+    }
+    chrono::duration<double, milli> setupTime = chrono::steady_clock::now() - start;
+
+    size_t guesses = 0;
+    start = chrono::steady_clock::now();
+    for (size_t pass = 0; pass < 26; pass++) {
+        for (GameSession& session : sessions) {
+            if (session.status == GAME_IN_PROGRESS) {
+                guessLetter(session, LETTER_ORDER[pass]);
+                guesses++;
+            }
+        }
+    }
+    chrono::duration<double, milli> playTime = chrono::steady_clock::now() - start;
+    PlayerStats stats;
+    for (const GameSession& session : sessions) {
+        recordGameResult(stats, gameStatus(session));
+    }
+
+    cout << "\nSessions (" << SESSIONS << " games on " << wordList.size() << " words, started in " << setupTime.count() << " ms)\n";
+    cout << "GameSession\t" << sessions.capacity() * sizeof(GameSession) / 1e6 << " MB\t" << sizeof(GameSession) << " bytes/game\n";
+    cout << "GameState\t" << stateBytes / 1e6 << " MB\t" << static_cast<double>(stateBytes) / SESSIONS << " bytes/game\n";
+    cout << guesses << " guesses in " << playTime.count() << " ms (" << playTime.count() * 1e6 / guesses << " ns/guess); " << stats.wonRounds
+         << " won, " << stats.lostRounds << " lost" << endl;
+    sessions = vector<GameSession>();  // Free the sessions before the next benchmark allocates its own.
+    runBatchGuessBenchmark(wordList, random);
+}
+
+/**
+ * @brief Plays the same games three ways and compares the time per guess: handleCharacterGuess() on GameStates
+ * (with its console output discarded), guessLetter() on GameStates, and SessionTable::applyGuesses() on batches.
+ * Every tick, each game guesses one letter, so a batch holds one guess per game; all three end with the same results.
+ * @param wordList The list to pick words from.
+ * @param random The generator of the word picks and guess orders.
+ */
+void runBatchGuessBenchmark(const WordList& wordList, RandomGenerator& random) {
+    const size_t GAMES = 1000000;  // Games played by each method
+    const int MAX_GUESSES = 8;
+    const int TICKS = 26;          // Enough for every game to end
+    vector<uint32_t> wordIds(GAMES);
+    vector<SessionId> ids(GAMES);
+    for (size_t i = 0; i < GAMES; i++) {
+        wordIds[i] = random.uniform(static_cast<uint32_t>(wordList.size()));
+        ids[i] = static_cast<SessionId>(i);
+    }
+    vector<char> letters(static_cast<size_t>(TICKS) * GAMES);  // Each game guesses the alphabet in its own rotated order
+    for (size_t i = 0; i < GAMES; i++) {
+        size_t start = random.uniform(26);
+        for (int tick = 0; tick < TICKS; tick++) {
+            letters[tick * GAMES + i] = static_cast<char>('A' + (start + tick) % 26);
+        }
+    }
+
+    vector<GameState> states(GAMES, GameState(MAX_GUESSES));
+    auto resetStates = [&]() {
+        for (size_t i = 0; i < GAMES; i++) {
+            newGame(states[i], wordList.word(wordIds[i]), wordList.hint(wordIds[i]), MAX_GUESSES, wordList.letterMask(wordIds[i]));
+        }
+    };
+    resetStates();
+    streambuf* console = cout.rdbuf(nullptr);  // Discards output (sets badbit) while the console front-end runs.
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    for (int tick = 0; tick < TICKS; tick++) {
+        for (size_t i = 0; i < GAMES; i++) {
+            handleCharacterGuess(states[i], letters[tick * GAMES + i]);
+        }
+    }
+    chrono::duration<double, milli> consoleTime = chrono::steady_clock::now() - start;
+    cout.rdbuf(console);
+    cout.clear();
+
+    resetStates();
+    start = chrono::steady_clock::now();
+    for (int tick = 0; tick < TICKS; tick++) {
+        for (size_t i = 0; i < GAMES; i++) {
+            guessLetter(states[i], letters[tick * GAMES + i]);
+        }
+    }
+    chrono::duration<double, milli> engineTime = chrono::steady_clock::now() - start;
+
+    SessionTable table;
+    table.resize(GAMES);
+    for (size_t i = 0; i < GAMES; i++) {
+        table.newGame(static_cast<SessionId>(i), wordList, wordIds[i], MAX_GUESSES);
+    }
+    start = chrono::steady_clock::now();
+    for (int tick = 0; tick < TICKS; tick++) {
+        table.applyGuesses(ids.data(), &letters[tick * GAMES], GAMES);
+    }
+    chrono::duration<double, milli> batchTime = chrono::steady_clock::now() - start;
+
+    size_t mismatches = 0;  // All three must agree on how every game ended.
+    for (size_t i = 0; i < GAMES; i++) {
+        mismatches += (table.status(static_cast<SessionId>(i)) != gameStatus(states[i])) ? 1 : 0;
+    }
+    double guesses = static_cast<double>(TICKS) * GAMES;
+    cout << "\nBatch guesses (" << GAMES << " games, " << TICKS << " ticks)\n";
+    cout << "method\tns/guess\tspeedup\n";
+    cout << "console\t" << consoleTime.count() * 1e6 / guesses << "\t1\n";
+    cout << "engine\t" << engineTime.count() * 1e6 / guesses << "\t" << consoleTime.count() / engineTime.count() << "\n";
+    cout << "batch\t" << batchTime.count() * 1e6 / guesses << "\t" << consoleTime.count() / batchTime.count() << "\n";
+    if (mismatches != 0) {
+        cerr << mismatches << " games ended differently in the batch table." << endl;
+    }
+    cout.flush();
+}
+
+/**
+ * @brief Runs the built-in checks (--self-test, also registered with ctest) and prints a line per check.
+ * @return True if every check passed.
+ */
+bool runSelfTest() {
+    bool passed = selfTestParser();
+    passed = selfTestShapes() && passed;
+    cout << (passed ? "All self-tests passed." : "Some self-tests FAILED.") << endl;
+    return passed;
+}
+
+/**
+ * @brief Reads "word,hint" rows the way the original line-based reader did: getline, then split at the first comma,
+ * skipping rows without a comma and, since tombstones were added, rows starting with TOMBSTONE_MARKER.
+ * This is the reference the block parser must match byte for byte.
+ * @param text The file contents.
+ * @param rows Receives the word and hint of each row.
+ */
+void readRowsWithGetline(const string& text, vector<pair<string, string>>& rows) {
+    istringstream input(text);
+    string line;
+    while (getline(input, line)) {
+        size_t delimiterPos = line.find(',');
+        if (delimiterPos != string::npos && line[0] != TOMBSTONE_MARKER) {
+            rows.push_back(make_pair(line.substr(0, delimiterPos), line.substr(delimiterPos + 1)));
+        }
+    }
+}
+
+/**
+ * @brief Checks the block parser against the line-based reader on adversarial inputs: CRLF line endings, a missing
+ * final newline, empty words and hints, NUL bytes, lines longer than a 64-byte block, and rows straddling block boundaries.
+ * The serial parser, the parallel parser, and every delimiter scanner the CPU supports must all agree with the reference.
+ * @return True if every input parsed identically.
+ */
+bool selfTestParser() {
+    const int RANDOM_INPUTS = 2000;
+    const char ALPHABET[] = {',', '\n', '\r', '#', '\0', 'a', 'Z', ' '};  // Bytes the parser must treat correctly
+    vector<string> inputs = {
+        "",
+        "apple,thing",                                                // No final newline
+        "apple,thing\r\npear,fruit\r\n",                             // CRLF
+        ",\n,\n,,\nword,\n,hint\n\n\n",                               // Empty fields and lines
+        "no comma here\n#deleted,row\nkept,row,with,commas\n",        // Skipped rows and extra commas
+        string(63, 'a') + ",hint\n" + string(64, 'b') + "\n" + string(65, 'c') + "," + string(200, 'd'),  // Block boundaries
+        string(1000, 'w') + "," + string(1000, 'h') + "\n" + string(5000, ',') + "\n",                   // Lines longer than a block
+        string("nul\0word,hi\0nt\n", 14) + "x,y",
+    };
+    RandomGenerator random(4);
+    for (int i = 0; i < RANDOM_INPUTS; i++) {
+        string input(random.uniform(300), ' ');
+        for (char& byte : input) {
+            byte = ALPHABET[random.uniform(sizeof(ALPHABET))];
+        }
+        inputs.push_back(input);
+    }
+    string large;  // Big enough to be split across threads
+    while (large.size() < (3u << 20)) {
+        large += string(1 + random.uniform(40), 'a' + static_cast<char>(random.uniform(26))) + (random.uniform(8) == 0 ? "\r\n" : ",hint\n");
+    }
+    inputs.push_back(large);
+
+    vector<DelimiterScanner> scanners(1, scanDelimitersScalar);
+#if defined(HANGMAN_HAVE_X86_SIMD) && defined(__SSE2__)
+    scanners.push_back(scanDelimitersSse2);
+#endif
+#ifdef HANGMAN_HAVE_X86_SIMD
+    if (__builtin_cpu_supports("avx2")) {
+        scanners.push_back(scanDelimitersAvx2);
+    }
+#endif
+
+    size_t failures = 0;
+    for (const string& input : inputs) {
+        vector<pair<string, string>> expected;
+        readRowsWithGetline(input, expected);
+        for (unsigned threads : {1u, 4u}) {
+            vector<WordView> words;
+            HintTable hints;
+            parseWordListParallel(words, hints, input.data(), input.data() + input.size(), threads);
+            bool same = words.size() == expected.size();
+            for (size_t row = 0; same && row < words.size(); row++) {
+                StrView hint = hints.text(words[row].hintId);
+                same = string(words[row].word, words[row].wordLength) == expected[row].first && string(hint.data, hint.size) == expected[row].second;
+            }
+            if (!same && failures++ == 0) {
+                cerr << "Parser mismatch with " << threads << " threads on a " << input.size() << "-byte input: " << words.size() << " rows, expected "
+                     << expected.size() << endl;
+            }
+        }
+        string padded = input + string(64 - input.size() % 64, '\0');
+        for (size_t block = 0; block < padded.size(); block += 64) {
+            DelimiterMasks reference = scanDelimitersScalar(padded.data() + block);
+            for (DelimiterScanner scan : scanners) {
+                DelimiterMasks masks = scan(padded.data() + block);
+                if ((masks.commas != reference.commas || masks.newlines != reference.newlines) && failures++ == 0) {
+                    cerr << "Delimiter scanner mismatch at byte " << block << endl;
+                }
+            }
+        }
+    }
+    cout << "parser: " << inputs.size() << " inputs, " << scanners.size() << " scanners, " << (failures == 0 ? "passed" : "FAILED") << endl;
+    return failures == 0;
+}
+
+/**
+ * @brief Checks that the word shape index offers each word under exactly the difficulties whose shape it fits,
+ * including long words with many distinct letters, whose bucket numbers do not fit in a byte.
+ * @return True if every difficulty counts and lists the same words as a direct scan of the list.
+ */
+bool selfTestShapes() {
+    const string CSV = "BLACKSMITH,ten distinct\nELDERBERRY,fruit\nUNCOPYRIGHTABLE,fifteen distinct\nDEBT,short\nMOM,three\n"
+                       "PNEUMONOULTRAMICROSCOPICSILICOVOLCANOCONIOSIS,longer than the last bucket\nAPPLE,fruit\n";
+    WordList wordList;
+    parseWordList(wordList.words, wordList.hints, CSV.data(), CSV.data() + CSV.size());
+    normalizeWordList(wordList);
+    wordList.buildMetadata();
+    size_t failures = 0;
+    for (int maxGuesses : {8, 4, 2}) {
+        WordShape shape = difficultyWordShape(maxGuesses);
+        for (size_t begin = 0; begin <= wordList.size(); begin++) {  // Every range of words, as a shard would limit them.
+            for (size_t end = begin; end <= wordList.size(); end++) {
+                vector<size_t> expected;
+                for (size_t i = begin; i < end; i++) {
+                    int length = static_cast<int>(min<size_t>(wordList.word(i).size, SHAPE_MAX_LENGTH));
+                    int distinct = countBits(wordList.letterMask(i));
+                    if (length >= shape.minLength && length <= shape.maxLength && distinct >= shape.minDistinct && distinct <= shape.maxDistinct) {
+                        expected.push_back(i);
+                    }
+                }
+                vector<size_t> offered;
+                for (size_t ordinal = 0; ordinal < wordList.shapes.count(shape, begin, end); ordinal++) {
+                    offered.push_back(wordList.shapes.nth(shape, begin, end, ordinal));
+                }
+                sort(offered.begin(), offered.end());
+                if (offered != expected && failures++ == 0) {
+                    cerr << "Shape index offers " << offered.size() << " words of [" << begin << ", " << end << ") for " << maxGuesses
+                         << " guesses, expected " << expected.size() << endl;
+                }
+            }
+        }
+    }
+    cout << "shapes: " << (failures == 0 ? "passed" : "FAILED") << endl;
+    return failures == 0;
+}
+
+// =========== WORD LIST FUNCTIONS ============ //
+
+/**
+ * @brief Brings the index up to date with a word list file, rebuilding it in one pass only when the file has changed.
+ * @param filename The path to the word list.
+ * @return True if the index describes the current file, false if the file cannot be read.
+ */
+bool WordListIndex::refresh(const string& filename) {
+    uint64_t size;
+    int64_t modified;
+    if (!fileSignature(filename, size, modified)) {
+        cerr << "Failed to open file for reading: " << filename << endl;
+        return false;
+    }
+    if (file.data() != nullptr && size == sourceSize && modified == sourceModified) {
+        return true;  // Unchanged since it was indexed
+    }
+    rowStarts.clear();
+    words.clear();
+    arena = TextArena();
+    sortedRows.clear();
+    wordTrie.clear();
+    if (!file.open(filename, false)) {
+        return false;
+    }
+    sourceSize = size;
+    sourceModified = modified;
+    size_t rewritten = 0;
+    auto addRow = [&](const char* line, const char* comma, const char*) {
+        rowStarts.push_back(line - file.data());
+        words.push_back(normalizeView(StrView(line, comma - line), arena, rewritten));
+    };
+    forEachRow(file.data(), file.data() + file.size(), addRow);
+    sortedRows.resize(rowStarts.size());
+    for (size_t i = 0; i < sortedRows.size(); i++) {
+        sortedRows[i] = static_cast<uint32_t>(i);
+    }
+    stable_sort(sortedRows.begin(), sortedRows.end(), [&](uint32_t left, uint32_t right) {
+        StrView a = word(left);
+        StrView b = word(right);
+        int order = memcmp(a.data, b.data, min(a.size, b.size));
+        return order < 0 || (order == 0 && a.size < b.size);
+    });
+    return true;
+}
+
+/**
+ * @brief Returns the bytes holding the rows of one page: from the start of its first row to the start of the next page.
+ * Deleted rows and rows without a comma between them are included and must be skipped when printing.
+ * @param page The page number, which must be below pageCount().
+ * @return A view into the mapped file.
+ */
+StrView WordListIndex::page(size_t page) const {
+    size_t first = page * VIEWER_PAGE_ROWS;
+    size_t next = first + VIEWER_PAGE_ROWS;
+    uint64_t end = (next < size()) ? rowStarts[next] : file.size();
+    return StrView(file.data() + rowStarts[first], end - rowStarts[first]);
+}
+
+/**
+ * @brief Finds the first word in sort order that starts with a prefix, by binary search over the sorted rows.
+ * @param prefix The uppercase prefix to look for.
+ * @return The row number (in file order) of the word, or size() if no word has the prefix.
+ */
+size_t WordListIndex::findPrefix(const StrView& prefix) const {
+    vector<uint32_t>::const_iterator found = lower_bound(sortedRows.begin(), sortedRows.end(), prefix, [&](uint32_t row, const StrView& key) {
+        StrView text = word(row);
+        int order = memcmp(text.data, key.data, min(text.size, key.size));
+        return order < 0 || (order == 0 && text.size < key.size);
+    });
+    if (found == sortedRows.end() || word(*found).size < prefix.size || memcmp(word(*found).data, prefix.data, prefix.size) != 0) {
+        return size();
+    }
+    return *found;
+}
+
+/**
+ * @brief Returns the full text of a row, up to (not including) its newline.
+ * @param row The row number, in file order.
+ * @return A view into the mapped file.
+ */
+StrView WordListIndex::row(size_t row) const {
+    const char* start = file.data() + rowStarts[row];
+    const char* end = file.data() + file.size();
+    const char* lineEnd = static_cast<const char*>(memchr(start, '\n', end - start));
+    return StrView(start, ((lineEnd == nullptr) ? end : lineEnd) - start);
+}
+
+/**
+ * @brief Returns the search trie of the indexed words, building it from the sorted rows the first time it is needed.
+ * @return The trie, valid until the next rebuild of the index.
+ */
+const WordTrie& WordListIndex::trie() {
+    if (wordTrie.empty()) {
+        wordTrie.build(sortedRows.size(), [&](size_t i) { return word(sortedRows[i]); }, sortedRows);
+    }
+    return wordTrie;
+}
+
+/**
+ * @brief Builds the trie from words given in sorted order, in a single pass.
+ * Because the words are sorted, a word can only share a path with the previous one, so each new child is appended
+ * after the last child of its parent and children stay sorted without any searching.
+ * @param count The number of words.
+ * @param sortedWord Called as sortedWord(i) to get the i-th word in sorted order.
+ * @param sortedRows The file row of the i-th word in sorted order.
+ */
+template <typename WordAt>
+void WordTrie::build(size_t count, const WordAt& sortedWord, const vector<uint32_t>& sortedRows) {
+    clear();
+    addChild(NO_NODE, NO_NODE, '\0');  // Root
+    vector<uint32_t> path(1, 0);        // Nodes along the previous word, from the root.
+    StrView previous(nullptr, 0);
+    for (size_t i = 0; i < count; i++) {
+        StrView word = sortedWord(i);
+        size_t shared = 0;
+        while (shared < word.size && shared < previous.size && word.data[shared] == previous.data[shared]) {
+            shared++;
+        }
+        // Where the word leaves the previous word's path, the previous word's node is the parent's last child.
+        uint32_t lastChild = (shared < previous.size) ? path[shared + 1] : NO_NODE;
+        path.resize(shared + 1);
+        for (size_t depth = shared; depth < word.size; depth++) {
+            path.push_back(addChild(path[depth], lastChild, word.data[depth]));
+            lastChild = NO_NODE;  // Deeper nodes are new, so they have no children yet.
+        }
+        if (wordRows[path[word.size]] == NO_NODE) {
+            wordRows[path[word.size]] = sortedRows[i];  // Duplicated words keep their first row (in sort order).
+        }
+        previous = word;
+    }
+}
+
+/**
+ * @brief Releases all nodes of the trie.
+ */
+void WordTrie::clear() {
+    firstChild.clear();
+    nextSibling.clear();
+    wordRows.clear();
+    letters.clear();
+}
+
+/**
+ * @brief Appends a node and links it as the new last child of its parent.
+ * @param parent The parent node, or NO_NODE for the root.
+ * @param lastChild The parent's current last child, or NO_NODE if it has none.
+ * @param letter The letter on the edge into the node.
+ * @return The new node.
+ */
+uint32_t WordTrie::addChild(uint32_t parent, uint32_t lastChild, char letter) {
+    uint32_t node = static_cast<uint32_t>(letters.size());
+    firstChild.push_back(NO_NODE);
+    nextSibling.push_back(NO_NODE);
+    wordRows.push_back(NO_NODE);
+    letters.push_back(letter);
+    if (lastChild != NO_NODE) {
+        nextSibling[lastChild] = node;
+    } else if (parent != NO_NODE) {
+        firstChild[parent] = node;
+    }
+    return node;
+}
+
+/**
+ * @brief Finds the words matching a pattern, in alphabetical order, stopping once enough are found.
+ * Only the branches that can still match are visited, so the cost follows the number of matches rather than the list size.
+ * @param pattern The letters to match; '_' matches any single letter.
+ * @param prefix True to match words that start with the pattern, false to match whole words only.
+ * @param limit The number of matches after which the search stops.
+ * @param rows Receives the file rows of the matching words.
+ * @return True if the search stopped at the limit (there may be more matches), false if it found them all.
+ */
+bool WordTrie::search(const StrView& pattern, bool prefix, size_t limit, vector<uint32_t>& rows) const {
+    rows.clear();
+    return !empty() && limit > 0 && collect(0, pattern, 0, prefix, limit, rows);
+}
+
+/**
+ * @brief Depth-first search step of search(): matches the pattern from a node at the given depth.
+ * @return True if the limit was reached.
+ */
+bool WordTrie::collect(uint32_t node, const StrView& pattern, size_t depth, bool prefix, size_t limit, vector<uint32_t>& rows) const {
+    if (depth == pattern.size && wordRows[node] != NO_NODE) {
+        rows.push_back(wordRows[node]);
+        if (rows.size() == limit) {
+            return true;
+        }
+    }
+    if (depth == pattern.size && !prefix) {
+        return false;
+    }
+    bool anyLetter = depth == pattern.size || pattern.data[depth] == '_';
+    size_t nextDepth = (depth == pattern.size) ? depth : depth + 1;  // Past the pattern, every descendant matches a prefix search.
+    for (uint32_t child = firstChild[node]; child != NO_NODE; child = nextSibling[child]) {
+        if (anyLetter || letters[child] == pattern.data[depth]) {
+            if (collect(child, pattern, nextDepth, prefix, limit, rows)) {
+                return true;
+            }
+            if (!anyLetter) {
+                break;  // Only one child can carry a given letter.
+            }
+        } else if (static_cast<unsigned char>(letters[child]) > static_cast<unsigned char>(pattern.data[depth])) {
+            break;  // Children are sorted (as unsigned bytes, like memcmp), so the letter is not among the rest.
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Prompts for a pattern and lists the words of the list that match it, with their hints.
+ * Letters match themselves, '_' matches any single letter, and a trailing '*' also matches longer words (a prefix search).
+ * @param filename The path to the word list.
+ * @param index The index of the file, whose search trie is reused while the file is unchanged.
+ */
+void searchWords(const string& filename, WordListIndex& index) {
+    const size_t SEARCH_LIMIT = 50;  // Matches shown per search
+    if (!index.refresh(filename)) {
+        return;
+    }
+    string pattern;
+    cout << "Enter a word or pattern ('_' matches any letter, a trailing '*' matches any ending): ";
+    getline(cin, pattern);
+    normalizeText(pattern);
+    bool prefix = !pattern.empty() && pattern.back() == '*';
+    if (prefix) {
+        pattern.pop_back();
+    }
+
+    vector<uint32_t> rows;
+    bool more = index.trie().search(StrView(pattern.data(), pattern.size()), prefix, SEARCH_LIMIT + 1, rows);
+    string output;
+    if (rows.empty()) {
+        output = "No words match " + pattern + (prefix ? "*" : "") + ".\n";
+    }
+    for (size_t i = 0; i < rows.size() && i < SEARCH_LIMIT; i++) {
+        output.append(index.row(rows[i]).str()).append(1, '\n');
+    }
+    if (more) {
+        output += "(more than " + to_string(SEARCH_LIMIT) + " matches; refine the pattern to see the rest)\n";
+    }
+    cout << output << flush;
+}
+
+/**
+ * @brief Shows the words and hints of a word list one page at a time.
+ * Each page is cut from the file with the line-offset index and printed with a single flush.
+ * Enter shows the next page, 'P' the previous one, a number jumps to that page, '/PREFIX' jumps to the page
+ * of the first word (alphabetically) starting with PREFIX, and 'Q' returns to the menu.
+ * @param filename The path to the file containing words and hints.
+ * @param index The index of the file, reused across calls while the file is unchanged.
+ */
+void displayWords(const string& filename, WordListIndex& index) {
+    if (!index.refresh(filename)) {
+        return;
+    }
+    if (index.size() == 0) {
+        cout << "The word list is empty.\n";
+        return;
+    }
+    size_t page = 0;
+    string status;
+    string output;
+    string command;
+    while (true) {
+        output = "Existing Words and Hints (page " + to_string(page + 1) + " of " + to_string(index.pageCount()) + "):\n";
+        StrView rows = index.page(page);
+        const char* end = rows.data + rows.size;
+        for (const char* line = rows.data; line < end;) {
+            const char* lineEnd = static_cast<const char*>(memchr(line, '\n', end - line));
+            lineEnd = (lineEnd == nullptr) ? end : lineEnd;
+            if (lineEnd > line && *line != TOMBSTONE_MARKER && memchr(line, ',', lineEnd - line) != nullptr) {
+                output.append(line, lineEnd).append(1, '\n');
+            }
+            line = lineEnd + 1;
+        }
+        output += status;
+        output += "[Enter] next, [P] previous, [number] go to page, [/prefix] find word, [Q] quit\n>>> ";
+        cout << output << flush;  // One write and flush per page
+        status.clear();
+
+        if (!getline(cin, command)) {
+            return;
+        }
+        convertToUpper(command);
+        if (command.empty()) {
+            page = min(page + 1, index.pageCount() - 1);
+        } else if (command == "P") {
+            page = (page > 0) ? page - 1 : 0;
+        } else if (command == "Q") {
+            return;
+        } else if (command[0] == '/') {
+            size_t row = index.findPrefix(StrView(command.data() + 1, command.size() - 1));
+            if (row == index.size()) {
+                status = "No word starts with " + command.substr(1) + ".\n";
+            } else {
+                page = row / VIEWER_PAGE_ROWS;
+                status = "First match: " + index.word(row).str() + " (row " + to_string(row + 1) + ").\n";
+            }
+        } else if (command.find_first_not_of("0123456789") == string::npos) {
+            unsigned long long requested = strtoull(command.c_str(), nullptr, 10);
+            if (requested >= 1 && requested <= index.pageCount()) {
+                page = static_cast<size_t>(requested - 1);
+            } else {
+                status = "Pages run from 1 to " + to_string(index.pageCount()) + ".\n";
+            }
+        } else {
+            status = "Unknown command.\n";
+        }
+    }
+}
+
+/**
+ * @brief Appends a new word and its hint to the specified file.
+ * Prompts the user for a word and a hint, then writes them to the file, ensuring data consistency by converting to uppercase.
+ * @param filename The path to the file where the new word and hint are appended.
+ */
+void appendWord(const string& filename) {
+    ofstream outputFile(filename, ios::app);  // Open the file in append mode
+    if (!outputFile) {
+        cerr << "Failed to open file for appending: " << filename << endl;
+        return;
+    }
+    string word;
+    string hint;
+    cout << "Enter a new word: ";
+    getline(cin, word);  // Use getline to allow spaces in the word
+    cout << "Enter a hint for the word: ";
+    getline(cin, hint);  // Use getline to allow spaces in the hint
+
+    convertToUpper(word);  // Convert the word to uppercase for consistency
+    convertToUpper(hint);  // Convert the hint to uppercase for consistency
+
+    // Ensure to start a new line if the file is not empty
+    outputFile << "\n"
+               << word << "," << hint;
+    cout << "New word and hint added successfully.\n";
+    outputFile.close();  // Close the file to flush changes
+}
+
+/**
+ * @brief Checks that a normalized word can be stored in the list: non-empty and made of the letters A-Z only.
+ * @param word The uppercase word to check.
+ * @return True if the word is valid, false otherwise.
+ */
+bool isValidWord(const string& word) {
+    if (word.empty()) {
+        return false;
+    }
+    for (char c : word) {
+        if (c < 'A' || c > 'Z') {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Imports every "word,hint" row of a source file into the word list in one batch.
+ * The source is streamed from a mapping; each row is normalized with normalizeText(), validated, and checked against
+ * a hash set of the words already in the list (normalized the same way, as the loader would see them) and those imported before it. The accepted rows are collected in one
+ * buffer, appended with a single write, and synced to disk once, so an import costs one append however many rows it has.
+ * @param filename The path to the word list to append to.
+ * @param sourceFilename The path to the file to import from.
+ * @return True if the import was written (or had nothing to write), false if a file could not be read or written.
+ */
+bool importWords(const string& filename, const string& sourceFilename) {
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    MappedFile source;
+    if (!source.open(sourceFilename)) {
+        cerr << "Failed to open file for importing: " << sourceFilename << endl;
+        return false;
+    }
+    MappedFile existing;
+    unordered_set<string> knownWords;
+    bool needSeparator = false;  // Rows are separated by '\n', with no newline after the last one (as appendWord() writes them).
+    if (existing.open(filename)) {
+        string known;
+        auto addKnown = [&](const char* line, const char* comma, const char*) {
+            known.assign(line, comma);
+            normalizeText(known);
+            knownWords.insert(known);
+        };
+        forEachRow(existing.data(), existing.data() + existing.size(), addKnown);
+        needSeparator = existing.size() > 0 && existing.data()[existing.size() - 1] != '\n';
+        existing.close();
+    }
+
+    string batch;  // Every accepted row, ready to be appended in one write.
+    size_t rowCount = 0;
+    size_t duplicateCount = 0;
+    size_t invalidCount = 0;
+    string word;
+    string hint;
+    auto importRow = [&](const char* line, const char* comma, const char* lineEnd) {
+        rowCount++;
+        word.assign(line, comma);
+        hint.assign(comma + 1, lineEnd);
+        normalizeText(word);
+        normalizeText(hint);  // Also drops the '\r' of sources saved with CRLF line endings.
+        if (!isValidWord(word) || hint.empty()) {
+            invalidCount++;
+        } else if (!knownWords.insert(word).second) {
+            duplicateCount++;
+        } else {
+            if (needSeparator) {
+                batch += '\n';
+            }
+            batch.append(word).append(1, ',').append(hint);
+            needSeparator = true;
+        }
+    };
+    knownWords.reserve(knownWords.size() + source.size() / 16);  // Rough row count, to avoid rehashing while importing.
+    forEachRow(source.data(), source.data() + source.size(), importRow);
+    source.close();
+
+    if (!batch.empty()) {
+#ifdef HANGMAN_HAVE_MMAP
+        int fd = ::open(filename.c_str(), O_WRONLY | O_APPEND | O_CREAT, 0644);
+        bool written = fd >= 0 && writeAll(fd, batch.data(), batch.size()) && fsync(fd) == 0;
+        if (fd >= 0) {
+            ::close(fd);
+        }
+#else
+        ofstream outputFile(filename, ios::app | ios::binary);
+        bool written = outputFile.write(batch.data(), batch.size()) && outputFile.flush();
+#endif
+        if (!written) {
+            cerr << "Failed to append imported words to file: " << filename << endl;
+            return false;
+        }
+    }
+
+    chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+    size_t importedCount = rowCount - duplicateCount - invalidCount;
+    cout << "Imported " << importedCount << " of " << rowCount << " words (" << duplicateCount << " duplicates, " << invalidCount
+         << " invalid) in " << elapsed.count() << " s, " << static_cast<size_t>(rowCount / max(elapsed.count(), 1e-9)) << " words/sec.\n";
+    return true;
+}
+
+/**
+ * @brief Replaces this mapping with another one, releasing the current mapping first.
+ * @param other The mapping to take ownership of.
+ * @return A reference to this mapping.
+ */
+MappedFile& MappedFile::operator=(MappedFile&& other) {
+    if (this != &other) {
+        close();
+        bytes = other.bytes;
+        length = other.length;
+        buffer = std::move(other.buffer);
+        other.bytes = nullptr;
+        other.length = 0;
+    }
+    return *this;
+}
+
+/**
+ * @brief Maps a whole file into memory for reading.
+ * Uses a private read-only mmap where available, otherwise reads the file into an owned buffer.
+ * A private mapping is not a copy: the pages are never written, so writes made to the file later (such as the
+ * tombstones of tombstoneRows()) show through them.
+ * An empty file opens successfully with a null data pointer and a size of zero.
+ * @param filename The path to the file to map.
+ * @param sequential True to hint a single front-to-back pass, false to hint random access.
+ * @return True if the file was opened, false otherwise.
+ */
+bool MappedFile::open(const string& filename, bool sequential) {
+    close();
+#ifdef HANGMAN_HAVE_MMAP
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        ::close(fd);
+        return false;
+    }
+    if (info.st_size > 0) {
+        void* mapping = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapping == MAP_FAILED) {
+            ::close(fd);
+            return false;
+        }
+        madvise(mapping, static_cast<size_t>(info.st_size), sequential ? MADV_SEQUENTIAL : MADV_RANDOM);
+        bytes = static_cast<const char*>(mapping);
+        length = static_cast<size_t>(info.st_size);
+    }
+    ::close(fd);  // The mapping stays valid after the descriptor is closed.
+    return true;
+#else
+    ifstream inputFile(filename, ios::binary);
+    if (!inputFile) {
+        return false;
+    }
+    (void)sequential;
+    buffer.assign(istreambuf_iterator<char>(inputFile), istreambuf_iterator<char>());
+    bytes = buffer.empty() ? nullptr : buffer.data();
+    length = buffer.size();
+    return true;
+#endif
+}
+
+/**
+ * @brief Releases the mapping or buffer held by this object.
+ */
+void MappedFile::close() {
+#ifdef HANGMAN_HAVE_MMAP
+    if (bytes != nullptr && buffer.empty()) {
+        munmap(const_cast<char*>(bytes), length);
+    }
+#endif
+    buffer.clear();
+    bytes = nullptr;
+    length = 0;
+}
+
+/**
+ * @brief Builds the comma and newline bitmaps of a 64-byte block one byte at a time.
+ * This is the portable fallback for targets without SIMD support.
+ * @param block The 64 bytes to scan.
+ * @return The delimiter bitmaps of the block.
+ */
+DelimiterMasks scanDelimitersScalar(const char* block) {
+    DelimiterMasks masks = {0, 0};
+    for (int i = 0; i < 64; i++) {
+        masks.commas |= static_cast<uint64_t>(block[i] == ',') << i;
+        masks.newlines |= static_cast<uint64_t>(block[i] == '\n') << i;
+    }
+    return masks;
+}
+
+#if defined(HANGMAN_HAVE_X86_SIMD) && defined(__SSE2__)
+/**
+ * @brief Builds the comma and newline bitmaps of a 64-byte block with four 16-byte SSE2 compares per delimiter.
+ * @param block The 64 bytes to scan.
+ * @return The delimiter bitmaps of the block.
+ */
+DelimiterMasks scanDelimitersSse2(const char* block) {
+    const __m128i comma = _mm_set1_epi8(',');
+    const __m128i newline = _mm_set1_epi8('\n');
+    DelimiterMasks masks = {0, 0};
+    for (int i = 0; i < 4; i++) {
+        __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + 16 * i));
+        masks.commas |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, comma)))) << (16 * i);
+        masks.newlines |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, newline)))) << (16 * i);
+    }
+    return masks;
+}
+#endif
+
+#ifdef HANGMAN_HAVE_X86_SIMD
+/**
+ * @brief Builds the comma and newline bitmaps of a 64-byte block with two 32-byte AVX2 compares per delimiter.
+ * Compiled for AVX2 regardless of the build flags; only called when the CPU reports AVX2 support.
+ * @param block The 64 bytes to scan.
+ * @return The delimiter bitmaps of the block.
+ */
+__attribute__((target("avx2"))) DelimiterMasks scanDelimitersAvx2(const char* block) {
+    const __m256i comma = _mm256_set1_epi8(',');
+    const __m256i newline = _mm256_set1_epi8('\n');
+    __m256i low = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block));
+    __m256i high = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + 32));
+    DelimiterMasks masks;
+    masks.commas = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(low, comma))) |
+                   static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(high, comma)))) << 32;
+    masks.newlines = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(low, newline))) |
+                     static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(high, newline)))) << 32;
+    return masks;
+}
+#endif
+
+/**
+ * @brief Picks the fastest delimiter scanner supported by the running CPU: AVX2, then SSE2, then the scalar loop.
+ * @param name Receives the name of the chosen scanner, for reporting.
+ * @return The chosen scanner.
+ */
+DelimiterScanner selectDelimiterScanner(const char*& name) {
+#ifdef HANGMAN_HAVE_X86_SIMD
+    if (__builtin_cpu_supports("avx2")) {
+        name = "AVX2";
+        return scanDelimitersAvx2;
+    }
+#endif
+#if defined(HANGMAN_HAVE_X86_SIMD) && defined(__SSE2__)
+    name = "SSE2";
+    return scanDelimitersSse2;
+#else
+    name = "scalar";
+    return scanDelimitersScalar;
+#endif
+}
+
+/**
+ * @brief Returns the index of the lowest set bit of a non-zero mask.
+ * @param mask The mask to inspect; must not be zero.
+ * @return The bit index, from 0 to 63.
+ */
+inline int lowestSetBit(uint64_t mask) {
+#ifdef __GNUC__
+    return __builtin_ctzll(mask);
+#else
+    int index = 0;
+    while ((mask & 1) == 0) {
+        mask >>= 1;
+        index++;
+    }
+    return index;
+#endif
+}
+
+/**
+ * @brief Counts the set bits of a mask.
+ * @param mask The mask to inspect.
+ * @return The number of set bits.
+ */
+inline int countBits(uint32_t mask) {
+#ifdef __GNUC__
+    return __builtin_popcount(mask);
+#else
+    int count = 0;
+    for (; mask != 0; mask &= mask - 1) {
+        count++;
+    }
+    return count;
+#endif
+}
+
+/**
+ * @brief Builds the set of letters that occur in a word, ignoring case; bit 0 is 'A' and bit 25 is 'Z'.
+ * @param word The word to inspect. Characters other than letters are ignored.
+ * @return The 26-bit letter mask.
+ */
+uint32_t letterMask(const StrView& word) {
+    uint32_t mask = 0;
+    for (size_t i = 0; i < word.size; i++) {
+        mask |= letterBit(static_cast<char>(toupper(static_cast<unsigned char>(word.data[i]))));
+    }
+    return mask;
+}
+
+/**
+ * @brief Returns the mask bit of an uppercase letter, as used by letterMask().
+ * @param letter The letter.
+ * @return The letter's bit, or 0 for anything other than 'A' to 'Z'.
+ */
+uint32_t letterBit(char letter) {
+    return (letter >= 'A' && letter <= 'Z') ? 1u << (letter - 'A') : 0;
+}
+
+/**
+ * @brief Groups word indices by bucket with a counting sort, given the bucket of each word.
+ * @param bucketOfWord The bucket number of each word, in word order.
+ */
+void WordShapeIndex::build(const vector<uint16_t>& bucketOfWord) {
+    ownedStarts.assign(SHAPE_BUCKETS + 1, 0);
+    for (uint16_t bucket : bucketOfWord) {
+        ownedStarts[bucket + 1]++;
+    }
+    for (int bucket = 0; bucket < SHAPE_BUCKETS; bucket++) {
+        ownedStarts[bucket + 1] += ownedStarts[bucket];
+    }
+    vector<uint32_t> next(ownedStarts.begin(), ownedStarts.end() - 1);  // Next free slot of each bucket.
+    ownedOrder.resize(bucketOfWord.size());
+    for (size_t i = 0; i < bucketOfWord.size(); i++) {
+        ownedOrder[next[bucketOfWord[i]]++] = static_cast<uint32_t>(i);
+    }
+    starts = ownedStarts.data();
+    order = ownedOrder.data();
+    wordCount = bucketOfWord.size();
+}
+
+/**
+ * @brief Points the index at bucket arrays stored elsewhere (in a mapped compiled list) instead of owning them.
+ * The bucket starts must already be known to rise from 0 to words; the word indices are only checked by nth().
+ * @param bucketStarts SHAPE_BUCKETS + 1 bucket start offsets.
+ * @param wordOrder The word indices grouped by bucket.
+ * @param words The number of words in the list.
+ */
+void WordShapeIndex::attach(const uint32_t* bucketStarts, const uint32_t* wordOrder, size_t words) {
+    clear();
+    starts = bucketStarts;
+    order = wordOrder;
+    wordCount = words;
+}
+
+/**
+ * @brief Empties the index.
+ */
+void WordShapeIndex::clear() {
+    ownedStarts.clear();
+    ownedOrder.clear();
+    starts = nullptr;
+    order = nullptr;
+    wordCount = 0;
+}
+
+/**
+ * @brief Finds the positions in order of a bucket's words that fall within a range of word indices.
+ * The counting sort keeps each bucket's word indices ascending, so a range is found by binary search;
+ * for the whole list the bucket is taken as is.
+ * @param bucket The bucket number.
+ * @param begin The first word index of the range.
+ * @param end One past the last word index of the range.
+ * @param first Receives the position of the bucket's first word in the range.
+ * @param last Receives one past the position of its last word in the range.
+ */
+void WordShapeIndex::bucketRange(int bucket, size_t begin, size_t end, size_t& first, size_t& last) const {
+    first = starts[bucket];
+    last = starts[bucket + 1];
+    if (begin == 0 && end >= wordCount) {
+        return;
+    }
+    first = lower_bound(order + first, order + last, begin) - order;
+    last = lower_bound(order + first, order + last, end) - order;
+}
+
+/**
+ * @brief Counts the words of a range whose length and distinct-letter count fall within a shape.
+ * Only the bucket counts are consulted (a fixed number of buckets, plus a binary search in each for part of the list),
+ * so the cost barely depends on the size of the list.
+ * @param shape The accepted ranges of length and distinct letters.
+ * @param begin The first word index to count.
+ * @param end One past the last word index to count.
+ * @return The number of matching words.
+ */
+size_t WordShapeIndex::count(const WordShape& shape, size_t begin, size_t end) const {
+    size_t total = 0;
+    forEachBucket(shape, [&](int bucket) {
+        size_t first;
+        size_t last;
+        bucketRange(bucket, begin, end, first, last);
+        total += last - first;
+        return false;
+    });
+    return total;
+}
+
+/**
+ * @brief Finds the word at a given position among the words of a range matching a shape, walking the matching buckets in order.
+ * @param shape The accepted ranges of length and distinct letters.
+ * @param begin The first word index of the range.
+ * @param end One past the last word index of the range.
+ * @param ordinal The position of the word among the matching words; must be less than count(shape, begin, end).
+ * @return The index of that word in the word list (0 for an out-of-range entry of a corrupt compiled list).
+ */
+size_t WordShapeIndex::nth(const WordShape& shape, size_t begin, size_t end, size_t ordinal) const {
+    size_t index = 0;
+    forEachBucket(shape, [&](int bucket) {
+        size_t first;
+        size_t last;
+        bucketRange(bucket, begin, end, first, last);
+        if (ordinal < last - first) {
+            index = order[first + ordinal];
+            index = (index < wordCount) ? index : 0;
+            return true;
+        }
+        ordinal -= last - first;
+        return false;
+    });
+    return index;
+}
+/**
+ * @brief Draws the next position from the shuffle bag.
+ * Swaps a random not-yet-drawn slot into the cursor position and hands it out, so no position repeats
+ * until all count positions have been drawn. A new bag is started (in O(count), amortized over the bag) when
+ * the current one is exhausted or when count changes, e.g. after the word list is reloaded.
+ * @param count The number of positions in the bag; must be at least 1.
+ * @return A position in [0, count).
+ */
+size_t WordScheduler::next(size_t count) {
+    if (slots.size() != count || cursor >= count) {
+        slots.assign(count, 0);
+        cursor = 0;
+    }
+    size_t swapIndex = cursor + random.uniform(static_cast<uint32_t>(count - cursor));
+    uint32_t drawn = (slots[swapIndex] != 0) ? slots[swapIndex] - 1 : static_cast<uint32_t>(swapIndex);
+    slots[swapIndex] = (slots[cursor] != 0) ? slots[cursor] : static_cast<uint32_t>(cursor) + 1;
+    slots[cursor] = drawn + 1;
+    cursor++;
+    return drawn;
+}
+
+/**
+ * @brief Chooses the next word for a session.
+ * When the session is limited to one shard of a sharded list, only that shard's words are played.
+ * Among them, words whose shape suits the difficulty are preferred: the choice ranges over the words matching the shape
+ * (or over all of them when none match). When selection weights are published for this list and shard, the word is drawn
+ * by weight in O(1) (see pickWeightedWord()); otherwise it comes from the session's shuffle bag.
+ * @param wordList The word list to choose from; must not be empty.
+ * @param weights The published selection weights, or null when there are none.
+ * @param shape The preferred word shape.
+ * @param shard The shard to choose from, or empty for the whole list.
+ * @param scheduler The session's shuffle bag.
+ * @return The index of the chosen word.
+ */
+size_t scheduleWord(const WordList& wordList, const WordWeights* weights, const WordShape& shape, const string& shard, WordScheduler& scheduler) {
+    size_t begin = 0;
+    size_t end = wordList.size();
+    if (!shard.empty() && (!wordList.shardRange(shard, begin, end) || end == begin)) {
+        begin = 0;  // No such shard (or an empty one): play the whole list.
+        end = wordList.size();
+    }
+    size_t word;
+    size_t matching = wordList.shapes.count(shape, begin, end);
+    if (weights != nullptr && weights->appliesTo(wordList, shard)) {
+        word = pickWeightedWord(*weights, shape, scheduler);
+    } else if (matching == 0) {
+        word = begin + scheduler.next(end - begin);
+    } else {
+        word = wordList.shapes.nth(shape, begin, end, scheduler.next(matching));
+    }
+    scheduler.remember(word);
+    return word;
+}
+
+/**
+ * @brief Draws a word by weight, from the words matching the shape when any of them has a positive weight.
+ * When none does (or no word matches the shape), the draw ranges over every word played, as the shuffle bag does.
+ * Weighted draws are made with replacement, since a heavier word is meant to come up more often, so unlike the
+ * shuffle bag they can repeat a word before every other one has been played. They only redraw, a few times,
+ * to avoid giving a session the same word twice in a row.
+ * @param weights The published selection weights; must apply to the list being played.
+ * @param shape The preferred word shape.
+ * @param scheduler The session's shuffle bag, providing the generator and the previous word.
+ * @return The index of the chosen word.
+ */
+size_t pickWeightedWord(const WordWeights& weights, const WordShape& shape, WordScheduler& scheduler) {
+    const int REDRAWS = 4;  // Draws spent avoiding an immediate repeat; a list with one drawable word repeats it.
+    const WeightedWords* shapeWeights = weights.forShape(shape);
+    const WeightedWords& drawn = (shapeWeights != nullptr) ? *shapeWeights : weights.all;
+    size_t word = 0;
+    for (int draw = 0; draw < REDRAWS; draw++) {
+        word = drawn.words[drawn.table.pick(scheduler.generator())];
+        if (word != scheduler.previous()) {
+            break;
+        }
+    }
+    return word;
+}
+
+/**
+ * @brief Finds the weights restricted to a difficulty's shape.
+ * @param shape The shape to look up.
+ * @return The shape's weights, or null when no word matches the shape or every matching word weighs 0.
+ */
+const WeightedWords* WordWeights::forShape(const WordShape& shape) const {
+    for (const WeightedWords& candidate : shapes) {
+        if (candidate.shape.minLength == shape.minLength && candidate.shape.maxLength == shape.maxLength &&
+            candidate.shape.minDistinct == shape.minDistinct && candidate.shape.maxDistinct == shape.maxDistinct) {
+            return candidate.table.empty() ? nullptr : &candidate;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Returns room for a copy of length bytes, starting a new block when the current one is full.
+ * @param length The number of bytes needed.
+ * @return Storage that stays valid and in place for the life of the arena.
+ */
+char* TextArena::allocate(size_t length) {
+    if (blocks.empty() || capacity - used < length) {
+        capacity = max(BLOCK_SIZE, length);
+        blocks.push_back(unique_ptr<char[]>(new char[capacity]));
+        used = 0;
+    }
+    char* room = blocks.back().get() + used;
+    used += length;
+    return room;
+}
+
+/**
+ * @brief Creates a set with room for the expected number of words at a load factor of at most one half.
+ * @param expected The largest number of words that will be inserted.
+ */
+WordSet::WordSet(size_t expected) {
+    size_t size = 16;
+    while (size < expected * 2) {
+        size *= 2;
+    }
+    slots.assign(size, StrView());
+    mask = size - 1;
+}
+
+/**
+ * @brief Adds a word to the set unless an equal word is already in it.
+ * @param word The word; it must stay valid for as long as the set is used.
+ * @return True if the word was added, false if it was a duplicate.
+ */
+bool WordSet::insert(const StrView& word) {
+    for (size_t slot = StrViewHash()(word) & mask;; slot = (slot + 1) & mask) {
+        if (slots[slot].data == nullptr) {
+            slots[slot] = word;
+            return true;
+        }
+        if (slots[slot] == word) {
+            return false;
+        }
+    }
+}
+
+/**
+ * @brief Trims whitespace, including a '\r' left by CRLF line endings, from both ends of a view.
+ * @param text The text to trim.
+ * @return The trimmed view, which points into the same bytes.
+ */
+StrView trimView(const StrView& text) {
+    const char* begin = text.data;
+    const char* end = text.data + text.size;
+    while (begin < end && isspace(static_cast<unsigned char>(*begin))) {
+        begin++;
+    }
+    while (end > begin && isspace(static_cast<unsigned char>(end[-1]))) {
+        end--;
+    }
+    return StrView(begin, end - begin);
+}
+
+/**
+ * @brief Normalizes a word or hint: trims it and uppercases its letters.
+ * Trimming only narrows the view; the text is copied into the arena only when it has lowercase letters.
+ * @param text The text to normalize.
+ * @param arena Storage for the copy, if one is needed.
+ * @param rewritten Incremented when a copy is made.
+ * @return A view of the normalized text.
+ */
+StrView normalizeView(const StrView& text, TextArena& arena, size_t& rewritten) {
+    StrView trimmed = trimView(text);
+    size_t first = 0;
+    while (first < trimmed.size && !islower(static_cast<unsigned char>(trimmed.data[first]))) {
+        first++;
+    }
+    if (first == trimmed.size) {
+        return trimmed;  // Already clean: no copy
+    }
+    char* copy = arena.allocate(trimmed.size);
+    for (size_t i = 0; i < trimmed.size; i++) {
+        copy[i] = static_cast<char>(toupper(static_cast<unsigned char>(trimmed.data[i])));
+    }
+    rewritten++;
+    return StrView(copy, trimmed.size);
+}
+
+/**
+ * @brief Normalizes a freshly parsed word list once, so picked words need no per-round transforms.
+ * Words and hints are trimmed and uppercased (see normalizeView()); hints that become equal are merged, and rows whose
+ * word is empty or repeats an earlier word are dropped, using an open-addressing set of the words kept so far.
+ * Shard boundaries are moved to account for the dropped rows. The outcome is recorded in the list's report.
+ * @param wordList The list to normalize, loaded from a CSV file, shards, or the built-in list.
+ */
+void normalizeWordList(WordList& wordList) {
+    LoadReport& report = wordList.report;
+    report = LoadReport();
+    report.rows = wordList.words.size();
+
+    HintTable hints;
+    vector<uint32_t> remap(wordList.hints.size());  // Old hint id to normalized hint id.
+    for (uint32_t id = 0; id < remap.size(); id++) {
+        remap[id] = hints.intern(normalizeView(wordList.hints.text(id), wordList.arena, report.rewritten));
+    }
+
+    vector<WordView>& words = wordList.words;
+    vector<size_t>& shardStarts = wordList.shardStarts;
+    WordSet seen(words.size());
+    size_t kept = 0;
+    size_t shard = 0;
+    for (size_t i = 0; i < words.size(); i++) {
+        while (shard < shardStarts.size() && shardStarts[shard] == i) {
+            shardStarts[shard++] = kept;
+        }
+        StrView word = normalizeView(StrView(words[i].word, words[i].wordLength), wordList.arena, report.rewritten);
+        if (word.size == 0) {
+            report.empty++;
+        } else if (!seen.insert(word)) {
+            report.duplicates++;
+        } else {
+            WordView view = {word.data, static_cast<uint32_t>(word.size), remap[words[i].hintId]};
+            words[kept++] = view;
+        }
+    }
+    while (shard < shardStarts.size()) {
+        shardStarts[shard++] = kept;
+    }
+    words.resize(kept);
+    swap(wordList.hints, hints);
+}
+
+/**
+ * @brief Finds the words of a shard; they are contiguous because shards are merged one after another.
+ * @param name The shard's name.
+ * @param begin Receives the index of the shard's first word.
+ * @param end Receives the index one past the shard's last word.
+ * @return True if the list has a shard with that name, false otherwise.
+ */
+bool WordList::shardRange(const string& name, size_t& begin, size_t& end) const {
+    for (size_t shard = 0; shard < shardNames.size(); shard++) {
+        if (shardNames[shard] == name) {
+            begin = shardStarts[shard];
+            end = shardStarts[shard + 1];
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Returns the word a round plays. With a dictionary it is decoded from the front-coded copy,
+ * found through the load-order index that the shape index, weights and shards pick by.
+ * @param index The word's load-order index.
+ * @param decoded Holds the decoded word; the result points into it when the list has a dictionary.
+ * @return The word's text.
+ */
+StrView WordList::playedWord(size_t index, string& decoded) const {
+    if (!dictionary) {
+        return word(index);
+    }
+    dictionary->word(dictionary->position(index), decoded);
+    return StrView(decoded.data(), decoded.size());
+}
+
+/**
+ * @brief Returns the hint a round shows, from the dictionary when the list has one.
+ * @param index The word's load-order index.
+ * @return The hint's text, valid for as long as the list.
+ */
+StrView WordList::playedHint(size_t index) const {
+    return dictionary ? dictionary->hint(dictionary->position(index)) : hint(index);
+}
+
+/**
+ * @brief Precomputes the per-word metadata that never changes during a game: each word's letter mask,
+ * and the shape index built from each word's length and distinct-letter count.
+ */
+void WordList::buildMetadata() {
+    vector<uint16_t> bucketOfWord(size());
+    masks.resize(size());
+    for (size_t i = 0; i < size(); i++) {
+        StrView text = word(i);
+        masks[i] = ::letterMask(text);
+        bucketOfWord[i] = static_cast<uint16_t>(WordShapeIndex::bucketOf(text.size, countBits(masks[i])));
+    }
+    letterMasks = masks.data();
+    shapes.build(bucketOfWord);
+}
+
+/**
+ * @brief Appends an unsigned number in LEB128 form: seven bits per byte, with the high bit set on all but the last byte.
+ * @param bytes The buffer to append to.
+ * @param value The number to append.
+ */
+void appendVarint(vector<char>& bytes, uint32_t value) {
+    while (value >= 0x80) {
+        bytes.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    bytes.push_back(static_cast<char>(value));
+}
+
+/**
+ * @brief Reads a number written by appendVarint() and advances past it.
+ * @param position The read position, moved past the number.
+ * @return The number.
+ */
+uint32_t readVarint(const char*& position) {
+    uint32_t value = 0;
+    for (int shift = 0;; shift += 7) {
+        uint8_t byte = static_cast<uint8_t>(*position++);
+        value |= static_cast<uint32_t>(byte & 0x7F) << shift;
+        if (byte < 0x80) {
+            return value;
+        }
+    }
+}
+
+/**
+ * @brief Builds the dictionary from a word list: sorts the words, front-codes them in blocks, and copies the hints.
+ * @param wordList The list to compress; the dictionary does not refer to it afterwards.
+ */
+void FrontCodedDictionary::build(const WordList& wordList) {
+    count = wordList.size();
+    vector<uint32_t> order(count);
+    for (size_t i = 0; i < count; i++) {
+        order[i] = static_cast<uint32_t>(i);
+    }
+    stable_sort(order.begin(), order.end(), [&](uint32_t left, uint32_t right) {
+        StrView a = wordList.word(left);
+        StrView b = wordList.word(right);
+        int compared = memcmp(a.data, b.data, min(a.size, b.size));
+        return compared < 0 || (compared == 0 && a.size < b.size);
+    });
+
+    blob.clear();
+    blockStarts.clear();
+    hintIds.resize(count);
+    positions.resize(count);
+    StrView previous;
+    for (size_t i = 0; i < count; i++) {
+        StrView text = wordList.word(order[i]);
+        size_t shared = 0;
+        if (i % FRONT_CODING_BLOCK == 0) {
+            blockStarts.push_back(blob.size());
+        } else {
+            while (shared < text.size && shared < previous.size && text.data[shared] == previous.data[shared]) {
+                shared++;
+            }
+            appendVarint(blob, static_cast<uint32_t>(shared));
+        }
+        appendVarint(blob, static_cast<uint32_t>(text.size - shared));
+        blob.insert(blob.end(), text.data + shared, text.data + text.size);
+        hintIds[i] = wordList.hintId(order[i]);
+        positions[order[i]] = static_cast<uint32_t>(i);
+        previous = text;
+    }
+    blob.shrink_to_fit();
+    blockStarts.shrink_to_fit();
+
+    hintText.clear();
+    hintStarts.assign(1, 0);
+    for (uint32_t id = 0; id < wordList.hints.size(); id++) {
+        StrView text = wordList.hints.text(id);
+        hintText.append(text.data, text.size);
+        hintStarts.push_back(static_cast<uint32_t>(hintText.size()));
+    }
+    hintText.shrink_to_fit();
+}
+
+/**
+ * @brief Decodes one word by replaying its block from the block's whole first word.
+ * @param index The position of the word in sorted order.
+ * @param word Receives the word; its buffer is reused across calls.
+ */
+void FrontCodedDictionary::word(size_t index, string& word) const {
+    const char* position = blob.data() + blockStarts[index / FRONT_CODING_BLOCK];
+    size_t length = readVarint(position);
+    word.assign(position, length);
+    position += length;
+    for (size_t entry = index % FRONT_CODING_BLOCK; entry > 0; entry--) {
+        size_t shared = readVarint(position);
+        length = readVarint(position);
+        word.resize(shared);
+        word.append(position, length);
+        position += length;
+    }
+}
+
+/**
+ * @brief Returns the heap memory held by the dictionary.
+ * @return The number of bytes.
+ */
+size_t FrontCodedDictionary::memoryBytes() const {
+    return blob.capacity() + blockStarts.capacity() * sizeof(uint64_t) + (hintIds.capacity() + positions.capacity()) * sizeof(uint32_t) +
+           hintText.capacity() + hintStarts.capacity() * sizeof(uint32_t);
+}
+
+/**
+ * @brief Returns the id of a hint, assigning the next free id the first time a hint is seen.
+ * Repeats of the previous hint (the common case for lists grouped by category) skip the hash lookup.
+ * @param text The hint text; it must stay valid for as long as the table is used.
+ * @return The hint's id.
+ */
+uint32_t HintTable::intern(const StrView& text) {
+    if (!texts.empty() && text == lastText) {
+        return lastId;
+    }
+    unordered_map<StrView, uint32_t, StrViewHash>::const_iterator found = ids.find(text);
+    if (found != ids.end()) {
+        lastId = found->second;
+    } else {
+        lastId = static_cast<uint32_t>(texts.size());
+        texts.push_back(text);
+        ids.insert(make_pair(text, lastId));
+    }
+    lastText = text;
+    return lastId;
+}
+
+/**
+ * @brief Returns the delimiter scanner for the running CPU, choosing it on first use.
+ * @return The scanner chosen by selectDelimiterScanner().
+ */
+DelimiterScanner activeDelimiterScanner() {
+    static const char* scannerName;
+    static const DelimiterScanner scanDelimiters = selectDelimiterScanner(scannerName);
+    return scanDelimiters;
+}
+
+/**
+ * @brief Walks the "word,hint" rows of a block in a single pass, calling a handler for each row that has a comma.
+ * Matches the line-based reader it replaces: rows are separated by '\n', the word ends at the first comma,
+ * the hint is the rest of the row, and rows without a comma are skipped.
+ * Rows deleted with a tombstone (starting with TOMBSTONE_MARKER) are skipped too, so no loader needs a second pass.
+ * The bytes are scanned 64 at a time into delimiter bitmaps, so only commas and newlines are visited.
+ * @param begin The first byte of the block.
+ * @param end One past the last byte of the block.
+ * @param handleRow Called as handleRow(line, comma, lineEnd) with the row start, its first comma, and the end of the row.
+ */
+template <typename RowHandler>
+void forEachRow(const char* begin, const char* end, RowHandler& handleRow) {
+    const DelimiterScanner scanDelimiters = activeDelimiterScanner();
+    const char* line = begin;      // Start of the current row.
+    const char* comma = nullptr;   // First comma of the current row, if one has been seen.
+    char tail[64];                 // Zero-padded copy of the final partial block.
+    for (const char* block = begin; block < end; block += 64) {
+        DelimiterMasks masks;
+        if (end - block >= 64) {
+            masks = scanDelimiters(block);
+        } else {
+            memset(tail, 0, sizeof(tail));
+            memcpy(tail, block, end - block);
+            masks = scanDelimiters(tail);
+        }
+        uint64_t delimiters = masks.commas | masks.newlines;
+        while (delimiters != 0) {
+            int bit = lowestSetBit(delimiters);
+            const char* position = block + bit;
+            if ((masks.newlines >> bit) & 1) {
+                if (comma != nullptr && *line != TOMBSTONE_MARKER) {
+                    handleRow(line, comma, position);
+                }
+                line = position + 1;
+                comma = nullptr;
+            } else if (comma == nullptr) {
+                comma = position;
+            }
+            delimiters &= delimiters - 1;  // Clear the delimiter just handled.
+        }
+    }
+    if (comma != nullptr && *line != TOMBSTONE_MARKER) {  // The last row may have no trailing newline.
+        handleRow(line, comma, end);
+    }
+}
+
+/**
+ * @brief Splits a block of "word,hint" rows into views, in a single pass over the bytes.
+ * No per-word allocation is made: words are views into the block and hints are interned.
+ * @param words The vector that receives one WordView per valid row.
+ * @param hints The table the row hints are interned into.
+ * @param begin The first byte of the block.
+ * @param end One past the last byte of the block.
+ * @param progress Counters to add the parsed rows and bytes to every PROGRESS_ROWS rows, or null.
+ */
+void parseWordList(vector<WordView>& words, HintTable& hints, const char* begin, const char* end, LoadProgress* progress) {
+    const size_t PROGRESS_ROWS = 1 << 16;  // Rows between progress updates, to keep the shared counters off the hot path.
+    size_t reportedRows = words.size();
+    const char* reportedEnd = begin;
+    auto addRow = [&](const char* line, const char* comma, const char* lineEnd) {
+        WordView view = {line, static_cast<uint32_t>(comma - line), hints.intern(StrView(comma + 1, lineEnd - comma - 1))};
+        words.push_back(view);
+        if (progress != nullptr && words.size() - reportedRows == PROGRESS_ROWS) {
+            progress->rows += PROGRESS_ROWS;
+            progress->bytes += lineEnd - reportedEnd;
+            reportedRows = words.size();
+            reportedEnd = lineEnd;
+        }
+    };
+    forEachRow(begin, end, addRow);
+    if (progress != nullptr) {
+        progress->rows += words.size() - reportedRows;
+        progress->bytes += end - reportedEnd;
+    }
+}
+
+/**
+ * @brief Parses a block of rows on several threads, splitting it into chunks at newline boundaries.
+ * Each thread parses its chunk into a local vector and hint table; the chunks are then spliced into the output in file order,
+ * with their hint ids remapped into the shared table, so the result is identical to parseWordList().
+ * Small inputs are parsed on fewer threads (or just the caller's).
+ * @param words The vector that receives one WordView per valid row.
+ * @param hints The table the row hints are interned into.
+ * @param begin The first byte of the block.
+ * @param end One past the last byte of the block.
+ * @param threadCount The maximum number of threads to use.
+ * @param progress Counters that every thread adds its parsed rows and bytes to, or null.
+ */
+void parseWordListParallel(vector<WordView>& words, HintTable& hints, const char* begin, const char* end, unsigned threadCount,
+                           LoadProgress* progress) {
+    const size_t MIN_CHUNK_SIZE = 1 << 20;  // Chunks smaller than 1 MiB are not worth a thread.
+    size_t length = end - begin;
+    threadCount = static_cast<unsigned>(min<size_t>(threadCount, length / MIN_CHUNK_SIZE + 1));
+    if (threadCount <= 1) {
+        parseWordList(words, hints, begin, end, progress);
+        return;
+    }
+
+    vector<const char*> bounds(threadCount + 1, end);  // Chunk k covers [bounds[k], bounds[k + 1]).
+    bounds[0] = begin;
+    for (unsigned k = 1; k < threadCount; k++) {
+        const char* split = max(begin + length / threadCount * k, bounds[k - 1]);
+        const char* newline = static_cast<const char*>(memchr(split, '\n', end - split));
+        bounds[k] = (newline == nullptr) ? end : newline + 1;  // Start each chunk just after a newline.
+    }
+
+    vector<vector<WordView>> chunks(threadCount);
+    vector<HintTable> chunkHints(threadCount);
+    vector<thread> workers;
+    for (unsigned k = 1; k < threadCount; k++) {
+        workers.push_back(thread(parseWordList, ref(chunks[k]), ref(chunkHints[k]), bounds[k], bounds[k + 1], progress));
+    }
+    parseWordList(chunks[0], chunkHints[0], bounds[0], bounds[1], progress);  // The calling thread parses the first chunk.
+    for (thread& worker : workers) {
+        worker.join();
+    }
+
+    size_t total = words.size();
+    for (const vector<WordView>& chunk : chunks) {
+        total += chunk.size();
+    }
+    words.reserve(total);
+    for (unsigned k = 0; k < threadCount; k++) {
+        vector<uint32_t> remap(chunkHints[k].size());  // Chunk-local hint id to shared hint id.
+        for (uint32_t id = 0; id < remap.size(); id++) {
+            remap[id] = hints.intern(chunkHints[k].text(id));
+        }
+        for (WordView view : chunks[k]) {
+            view.hintId = remap[view.hintId];
+            words.push_back(view);
+        }
+    }
+}
+
+/**
+ * @brief Loads the word list by memory-mapping the data file, building a view of each word and interning each hint.
+ * Startup is one pass over the mapped bytes; the words stay in the page cache rather than in per-word strings.
+ * @param wordList The word list to fill. Any previous contents are replaced.
+ * @param filename The path to the file containing the words and hints.
+ * @param threadCount The number of threads used to parse the file.
+ * @param progress Counters updated as the file is parsed, or null.
+ * @return True if the file was loaded, false if it could not be opened.
+ */
+bool loadWordList(WordList& wordList, const string& filename, unsigned threadCount, LoadProgress* progress) {
+    wordList.words.clear();
+    wordList.hints.clear();
+    wordList.shapes.clear();
+    wordList.masks.clear();
+    wordList.letterMasks = nullptr;
+    wordList.rows = nullptr;
+    wordList.rowCount = 0;
+    if (!wordList.file.open(filename)) {
+        cerr << "Failed to open file: " << filename << endl;
+        return false;
+    }
+    const char* begin = wordList.file.data();
+    if (progress != nullptr) {
+        progress->totalBytes = wordList.file.size();
+    }
+    parseWordListParallel(wordList.words, wordList.hints, begin, begin + wordList.file.size(), threadCount, progress);
+    normalizeWordList(wordList);
+    wordList.buildMetadata();
+    return true;
+}
+
+/**
+ * @brief Reads the size and modification time of a file, used to tell whether a compiled list is still current.
+ * @param filename The path to the file.
+ * @param size Receives the file size in bytes.
+ * @param modified Receives the modification time in nanoseconds since the epoch (second resolution where the platform offers no more).
+ * @return True if the file exists, false otherwise.
+ */
+bool fileSignature(const string& filename, uint64_t& size, int64_t& modified) {
+    struct stat info;
+    if (stat(filename.c_str(), &info) != 0) {
+        return false;
+    }
+    size = static_cast<uint64_t>(info.st_size);
+#ifdef __linux__
+    modified = static_cast<int64_t>(info.st_mtim.tv_sec) * 1000000000 + info.st_mtim.tv_nsec;
+#else
+    modified = static_cast<int64_t>(info.st_mtime) * 1000000000;
+#endif
+    return true;
+}
+
+/**
+ * @brief Compiles a CSV word list into the binary format read by loadCompiledWordList().
+ * Writes a header, a fixed-width offset table, a hint table, the word shape index, the letter masks, and a blob holding the words followed by the distinct hints.
+ * The output is written to a temporary file and renamed into place, so readers never see a partial list.
+ * @param csvFilename The path to the source CSV file.
+ * @param compiledFilename The path of the compiled file to produce.
+ * @param threadCount The number of threads used to parse the CSV.
+ * @return True if the compiled list was written, false otherwise.
+ */
+bool compileWordList(const string& csvFilename, const string& compiledFilename, unsigned threadCount) {
+    WordList wordList;
+    CompiledHeader header;
+    if (!fileSignature(csvFilename, header.sourceSize, header.sourceModified) || !loadWordList(wordList, csvFilename, threadCount)) {
+        return false;
+    }
+    if (wordList.size() > numeric_limits<uint32_t>::max()) {
+        cerr << "Too many words to compile: " << wordList.size() << endl;
+        return false;
+    }
+    memcpy(header.magic, COMPILED_MAGIC, sizeof(header.magic));
+    header.version = COMPILED_VERSION;
+    header.rowCount = wordList.size();
+    header.hintCount = wordList.hints.size();
+
+    vector<CompiledRow> rows(wordList.size());
+    uint64_t offset = 0;
+    for (size_t i = 0; i < wordList.size(); i++) {
+        rows[i].offset = offset;
+        rows[i].wordLength = static_cast<uint32_t>(wordList.word(i).size);
+        rows[i].hintId = wordList.hintId(i);
+        offset += rows[i].wordLength;
+    }
+    vector<CompiledHint> hints(wordList.hints.size());
+    for (uint32_t id = 0; id < hints.size(); id++) {
+        hints[id].offset = offset;
+        hints[id].length = wordList.hints.text(id).size;
+        offset += hints[id].length;
+    }
+    header.blobSize = offset;
+
+    string tempFilename = compiledFilename + ".tmp";
+    ofstream outputFile(tempFilename, ios::binary | ios::trunc);
+    if (!outputFile) {
+        cerr << "Failed to open file for writing: " << tempFilename << endl;
+        return false;
+    }
+    outputFile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    outputFile.write(reinterpret_cast<const char*>(rows.data()), rows.size() * sizeof(CompiledRow));
+    outputFile.write(reinterpret_cast<const char*>(hints.data()), hints.size() * sizeof(CompiledHint));
+    outputFile.write(reinterpret_cast<const char*>(wordList.shapes.bucketStarts()), (SHAPE_BUCKETS + 1) * sizeof(uint32_t));
+    outputFile.write(reinterpret_cast<const char*>(wordList.shapes.wordOrder()), wordList.size() * sizeof(uint32_t));
+    outputFile.write(reinterpret_cast<const char*>(wordList.letterMasks), wordList.size() * sizeof(uint32_t));
+    for (size_t i = 0; i < wordList.size(); i++) {
+        outputFile.write(wordList.word(i).data, wordList.word(i).size);
+    }
+    for (uint32_t id = 0; id < hints.size(); id++) {
+        outputFile.write(wordList.hints.text(id).data, wordList.hints.text(id).size);
+    }
+    outputFile.close();
+    if (!outputFile || rename(tempFilename.c_str(), compiledFilename.c_str()) != 0) {
+        cerr << "Failed to write compiled word list: " << compiledFilename << endl;
+        remove(tempFilename.c_str());
+        return false;
+    }
+    cout << "Compiled " << header.rowCount << " words into " << compiledFilename << endl;
+    return true;
+}
+
+/**
+ * @brief Loads a compiled word list by mapping it and pointing the list at its offset table, shape index, letter masks, and blob.
+ * Only the small hint table is copied (and checked while it is); the other tables are used in place without reading them,
+ * so the load does not touch the rows. Their offsets are checked when a word is read instead (see WordList::word()).
+ * The list is only used if its header, hints, and shape buckets are valid and it was compiled from the current version
+ * of the CSV file; otherwise the caller should fall back to parsing the CSV.
+ * @param wordList The word list to fill. Any previous contents are replaced.
+ * @param compiledFilename The path to the compiled list.
+ * @param csvFilename The path to the CSV file the list should have been compiled from.
+ * @return True if the compiled list was loaded, false if it is missing, invalid, or stale.
+ */
+bool loadCompiledWordList(WordList& wordList, const string& compiledFilename, const string& csvFilename) {
+    uint64_t sourceSize;
+    int64_t sourceModified;
+    MappedFile file;
+    if (!fileSignature(csvFilename, sourceSize, sourceModified) || !file.open(compiledFilename, false) || file.size() < sizeof(CompiledHeader)) {
+        return false;
+    }
+    CompiledHeader header;
+    memcpy(&header, file.data(), sizeof(header));
+    bool valid = memcmp(header.magic, COMPILED_MAGIC, sizeof(header.magic)) == 0 && header.version == COMPILED_VERSION &&
+                 header.rowCount <= (file.size() - sizeof(header)) / sizeof(CompiledRow) &&
+                 header.hintCount <= (file.size() - sizeof(header)) / sizeof(CompiledHint) &&
+                 sizeof(header) + header.rowCount * (sizeof(CompiledRow) + 2 * sizeof(uint32_t)) + header.hintCount * sizeof(CompiledHint) +
+                         (SHAPE_BUCKETS + 1) * sizeof(uint32_t) + header.blobSize ==
+                     file.size() &&
+                 (header.rowCount == 0 || header.hintCount > 0);
+    if (!valid || header.sourceSize != sourceSize || header.sourceModified != sourceModified) {
+        return false;
+    }
+    const char* hintTable = file.data() + sizeof(header) + header.rowCount * sizeof(CompiledRow);
+    const uint32_t* bucketStarts = reinterpret_cast<const uint32_t*>(hintTable + header.hintCount * sizeof(CompiledHint));
+    if (!compiledTablesValid(header, hintTable, bucketStarts)) {
+        cerr << "The compiled word list " << compiledFilename << " is corrupt; reading " << csvFilename << " instead." << endl;
+        return false;
+    }
+    wordList.words.clear();
+    wordList.hints.clear();
+    wordList.file = std::move(file);
+    wordList.rows = reinterpret_cast<const CompiledRow*>(wordList.file.data() + sizeof(header));
+    wordList.rowCount = header.rowCount;
+    wordList.shapes.attach(bucketStarts, bucketStarts + SHAPE_BUCKETS + 1, header.rowCount);
+    wordList.masks.clear();
+    wordList.letterMasks = bucketStarts + SHAPE_BUCKETS + 1 + header.rowCount;
+    wordList.blob = reinterpret_cast<const char*>(wordList.letterMasks + header.rowCount);
+    wordList.blobSize = header.blobSize;
+    for (uint64_t id = 0; id < header.hintCount; id++) {
+        CompiledHint hint;
+        memcpy(&hint, hintTable + id * sizeof(CompiledHint), sizeof(hint));
+        wordList.hints.intern(StrView(wordList.blob + hint.offset, hint.length));
+    }
+    return true;
+}
+
+/**
+ * @brief Returns the word of a compiled row, checking its offset and length against the blob as it is read.
+ * @param index The row number, below size().
+ * @return The word, or an empty view when the row points outside the blob (a corrupt list).
+ */
+StrView WordList::compiledWord(size_t index) const {
+    const CompiledRow& row = rows[index];
+    if (row.offset > blobSize || row.wordLength > blobSize - row.offset) {
+        return StrView(blob, 0);
+    }
+    return StrView(blob + row.offset, row.wordLength);
+}
+
+/**
+ * @brief Returns the hint id of a compiled row, checked against the hint table as it is read.
+ * @param index The row number, below size().
+ * @return The hint id, or 0 when the row's id is out of range (a corrupt list); a list with rows always has a hint.
+ */
+uint32_t WordList::compiledHintId(size_t index) const {
+    uint32_t id = rows[index].hintId;
+    return (id < hints.size()) ? id : 0;
+}
+
+/**
+ * @brief Checks the small tables of a compiled list that the load reads anyway: every hint stays inside the blob, and
+ * the shape bucket starts rise from 0 to the row count, so walking the buckets stays inside the word order table.
+ * The rows and the word order table are not read here, so the check does not grow with the number of words;
+ * their entries are checked as they are used (see WordList::word() and WordShapeIndex::nth()).
+ * The header's sizes must already have been checked against the file size.
+ * @param header The list's header.
+ * @param hintTable The hint table, in the mapped file.
+ * @param bucketStarts The SHAPE_BUCKETS + 1 bucket starts, in the mapped file.
+ * @return True if the hints and bucket starts are valid, false otherwise.
+ */
+bool compiledTablesValid(const CompiledHeader& header, const char* hintTable, const uint32_t* bucketStarts) {
+    for (uint64_t id = 0; id < header.hintCount; id++) {
+        CompiledHint hint;
+        memcpy(&hint, hintTable + id * sizeof(CompiledHint), sizeof(hint));
+        if (hint.offset > header.blobSize || hint.length > header.blobSize - hint.offset) {
+            return false;
+        }
+    }
+    uint32_t previous = 0;
+    for (int bucket = 0; bucket <= SHAPE_BUCKETS; bucket++) {
+        uint32_t start;
+        memcpy(&start, bucketStarts + bucket, sizeof(start));
+        if (start < previous || start > header.rowCount || (bucket == 0 && start != 0) || (bucket == SHAPE_BUCKETS && start != header.rowCount)) {
+            return false;
+        }
+        previous = start;
+    }
+    return true;
+}
+
+/**
+ * @brief Loads the word list from disk and atomically publishes it as the new snapshot.
+ * An up-to-date compiled list is preferred over parsing the CSV, and the list built into the binary is used when
+ * the CSV is missing. Games that already hold the previous snapshot keep using it.
+ * If no list can be loaded, the current snapshot is left in place.
+ * @return True if a new list was published, false otherwise.
+ */
+bool WordListStore::reload() {
+    lock_guard<mutex> lock(reloading);
+    loadProgress.reset();
+    shared_ptr<WordList> wordList = make_shared<WordList>();
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    string timings;  // Per-shard timings, printed with the total when verbose.
+    if (!shardSource.empty()) {
+        vector<string> shardFilenames;
+        if (!listShards(shardSource, shardFilenames) || !loadShardedWordList(*wordList, shardFilenames, &loadProgress, timings)) {
+            return false;
+        }
+    } else if (!loadCompiledWordList(*wordList, compiledFilename, csvFilename)) {
+        uint64_t size;
+        int64_t modified;
+        if (fileSignature(csvFilename, size, modified)) {
+            if (!loadWordList(*wordList, csvFilename, threadCount, &loadProgress)) {
+                return false;  // The CSV exists but cannot be read
+            }
+        } else {
+            // Checked before loadWordList(), which would report the missing file from this thread even when the built-in list applies.
+            bool embedded = loadEmbeddedWordList(*wordList);
+            lock_guard<mutex> lock(messagesLock);
+            messages += embedded ? "Using the built-in word list instead.\n" : "Failed to open file: " + csvFilename + "\n";
+            if (!embedded) {
+                return false;
+            }
+        }
+    }
+    if (frontCoded) {
+        wordList->dictionary.reset(new FrontCodedDictionary());
+        wordList->dictionary->build(*wordList);  // Rounds decode their word from it; the views stay for the indexes and weights.
+    }
+    if (verbose) {
+        chrono::duration<double, milli> elapsed = chrono::steady_clock::now() - start;
+        const LoadReport& report = wordList->report;
+        lock_guard<mutex> lock(messagesLock);
+        messages += timings + "Loaded " + to_string(wordList->size()) + " words in " + to_string(elapsed.count()) + " ms (" + to_string(report.rows) +
+                    " rows, " + to_string(report.duplicates) + " duplicates and " + to_string(report.empty) + " empty words dropped, " +
+                    to_string(report.rewritten) + " words and hints normalized)\n";
+        if (wordList->dictionary) {
+            messages += "Front-coded dictionary: " + to_string(wordList->dictionary->memoryBytes()) + " bytes\n";
+        }
+    }
+    atomic_store(&current, WordListSnapshot(wordList));
+    publishWeights();
+    return true;
+}
+
+/**
+ * @brief Publishes the word list built into the binary as the new snapshot, for kiosk builds that should not touch the disk.
+ * @return True if the binary has a built-in list, false otherwise.
+ */
+bool WordListStore::loadEmbedded() {
+    lock_guard<mutex> lock(reloading);
+    shared_ptr<WordList> wordList = make_shared<WordList>();
+    if (!loadEmbeddedWordList(*wordList)) {
+        return false;
+    }
+    if (frontCoded) {
+        wordList->dictionary.reset(new FrontCodedDictionary());
+        wordList->dictionary->build(*wordList);  // Rounds decode their word from it; the views stay for the indexes and weights.
+    }
+    atomic_store(&current, WordListSnapshot(wordList));
+    return true;
+}
+
+/**
+ * @brief Starts loading the word list on a worker thread; waitForLoad() and progress() follow the load.
+ */
+void WordListStore::loadAsync() {
+    loading = async(launch::async, [this]() { return reload(); }).share();
+}
+
+/**
+ * @brief Waits up to a timeout for the load started by loadAsync() to finish.
+ * @param timeout The longest time to wait.
+ * @return True if no load is running (it finished or was never started), false if it is still running.
+ */
+bool WordListStore::waitForLoad(chrono::milliseconds timeout) const {
+    return !loading.valid() || loading.wait_for(timeout) == future_status::ready;
+}
+
+/**
+ * @brief Hands over the notes collected by loads on the loader and watcher threads, so they can be printed between
+ * prompts instead of in the middle of one.
+ * @return The notes since the last call; empty when there are none.
+ */
+string WordListStore::takeMessages() const {
+    lock_guard<mutex> lock(messagesLock);
+    string taken;
+    taken.swap(messages);
+    return taken;
+}
+
+/**
+ * @brief Rebuilds the selection weights for the current word list from the sidecar file and publishes them.
+ * A whole batch of weight changes written to the sidecar therefore costs a single alias table rebuild.
+ * Without a readable sidecar, the published weights are cleared and selection falls back to the shuffle bag.
+ * Takes the reload lock, so the weights are always built against the list that is published when they are.
+ */
+void WordListStore::reloadWeights() {
+    lock_guard<mutex> lock(reloading);
+    publishWeights();
+}
+
+/**
+ * @brief Builds the weights for the current snapshot and publishes them; the caller must hold the reload lock.
+ */
+void WordListStore::publishWeights() {
+    WordListSnapshot wordList = snapshot();
+    shared_ptr<WordWeights> weights = make_shared<WordWeights>();
+    string notes;
+    if (!loadWordWeights(*weights, wordList, weightsFilename, shardFilter, notes)) {
+        weights.reset();
+    }
+    atomic_store(&currentWeights, WordWeightsSnapshot(weights));
+    if (!notes.empty()) {
+        lock_guard<mutex> lock(messagesLock);
+        messages += notes;
+    }
+}
+
+/**
+ * @brief Starts a background thread that reloads the word list whenever the CSV file is written or replaced.
+ * The directory is watched rather than the file so that replacing the file (write to a temporary file, then rename) is also seen.
+ * @return True if the watcher was started, false if file watching is unavailable on this platform or failed.
+ */
+bool WordListStore::watch() {
+#ifdef HANGMAN_HAVE_INOTIFY
+    if (watcher.joinable()) {
+        return true;
+    }
+    int inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (inotifyFd < 0) {
+        return false;
+    }
+    // Watching the same directory twice returns the same descriptor, so both checks in watchLoop() still apply.
+    int listWatch = inotify_add_watch(inotifyFd, listDirectory().c_str(), IN_CLOSE_WRITE | IN_MOVED_TO);
+    int weightsWatch = inotify_add_watch(inotifyFd, fileDirectory(weightsFilename).c_str(), IN_CLOSE_WRITE | IN_MOVED_TO);
+    if (listWatch < 0) {
+        ::close(inotifyFd);
+        return false;
+    }
+    stopping = false;
+    watcher = thread(&WordListStore::watchLoop, this, inotifyFd, listWatch, weightsWatch);
+    return true;
+#else
+    return false;
+#endif
+}
+
+/**
+ * @brief Asks the watcher thread to exit and waits for it.
+ */
+void WordListStore::stopWatching() {
+    stopping = true;
+    if (watcher.joinable()) {
+        watcher.join();
+    }
+}
+
+/**
+ * @brief Body of the watcher thread: waits for changes to the CSV or weights files and reloads after each one.
+ * Polls with a short timeout so that stopWatching() is noticed promptly. Bursts of events are coalesced into one reload.
+ * @param inotifyFd The inotify descriptor; closed when the loop exits.
+ * @param listWatch The watch on listDirectory().
+ * @param weightsWatch The watch on the weights file's directory (negative if it could not be added).
+ */
+void WordListStore::watchLoop(int inotifyFd, int listWatch, int weightsWatch) {
+#ifdef HANGMAN_HAVE_INOTIFY
+    const int POLL_TIMEOUT_MS = 250;  // How often the stop flag is checked while idle.
+    string weightsName = fileBaseName(weightsFilename);
+    alignas(inotify_event) char buffer[4096];
+    while (!stopping) {
+        pollfd descriptor = {inotifyFd, POLLIN, 0};
+        if (poll(&descriptor, 1, POLL_TIMEOUT_MS) <= 0) {
+            continue;
+        }
+        bool listChanged = false;
+        bool weightsChanged = false;
+        ssize_t length;
+        while ((length = read(inotifyFd, buffer, sizeof(buffer))) > 0) {  // Drain every pending event.
+            for (char* next = buffer; next < buffer + length;) {
+                const inotify_event* event = reinterpret_cast<const inotify_event*>(next);
+                listChanged = listChanged || (event->len > 0 && event->wd == listWatch && isListFile(event->name));
+                weightsChanged = weightsChanged || (event->len > 0 && event->wd == weightsWatch && weightsName == event->name);
+                next += sizeof(inotify_event) + event->len;
+            }
+        }
+        if (listChanged) {
+            reload();  // Also rebuilds the weights for the new list.
+        } else if (weightsChanged) {
+            reloadWeights();
+        }
+    }
+    ::close(inotifyFd);
+#else
+    (void)inotifyFd;
+    (void)listWatch;
+    (void)weightsWatch;
+#endif
+}
+
+/**
+ * @brief Returns the directory whose files make up the list: the shard directory itself, or the directory of the CSV or manifest.
+ * @return The directory path.
+ */
+string WordListStore::listDirectory() const {
+    if (shardSource.empty()) {
+        return fileDirectory(csvFilename);
+    }
+    return isDirectory(shardSource) ? shardSource : fileDirectory(shardSource);
+}
+
+/**
+ * @brief Tells whether a changed file in listDirectory() affects the list, so the watcher knows to reload.
+ * @param name The file name reported by inotify.
+ * @return True for the CSV itself, or for any CSV shard and the manifest of a sharded list.
+ */
+bool WordListStore::isListFile(const string& name) const {
+    if (shardSource.empty()) {
+        return name == fileBaseName(csvFilename);
+    }
+    bool isCsv = name.size() > 4 && name.compare(name.size() - 4, 4, ".csv") == 0;
+    return isCsv || name == fileBaseName(shardSource);
+}
+
+/**
+ * @brief Resolves a shard source into the files to load.
+ * A directory contributes every ".csv" file in it, in name order. Any other file is a manifest listing one shard
+ * path per line, relative to the manifest's directory unless absolute; blank lines and lines starting with '#' are skipped.
+ * @param source The directory or manifest.
+ * @param shardFilenames Receives the shard paths.
+ * @return True if the source could be read, false otherwise.
+ */
+bool listShards(const string& source, vector<string>& shardFilenames) {
+    shardFilenames.clear();
+    if (isDirectory(source)) {
+#ifdef HANGMAN_HAVE_MMAP
+        DIR* directory = opendir(source.c_str());
+        if (directory == nullptr) {
+            cerr << "Failed to open directory: " << source << endl;
+            return false;
+        }
+        while (const dirent* entry = readdir(directory)) {
+            string name = entry->d_name;
+            if (name.size() > 4 && name.compare(name.size() - 4, 4, ".csv") == 0) {
+                shardFilenames.push_back(source + "/" + name);
+            }
+        }
+        closedir(directory);
+        sort(shardFilenames.begin(), shardFilenames.end());
+        return true;
+#else
+        cerr << "Loading shards from a directory is not supported on this platform: " << source << endl;
+        return false;
+#endif
+    }
+    ifstream manifest(source);
+    if (!manifest) {
+        cerr << "Failed to open file for reading: " << source << endl;
+        return false;
+    }
+    string line;
+    while (getline(manifest, line)) {
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+        shardFilenames.push_back(line[0] == '/' ? line : fileDirectory(source) + "/" + line);
+    }
+    return true;
+}
+
+/**
+ * @brief Loads a word list from several shard files, parsing each shard as its own task, and merges them in order.
+ * Each task maps and parses one shard into its own views and hint table; the merge then appends the shards one after
+ * another with their hint ids remapped into the shared table, so each shard's words form one contiguous range.
+ * @param wordList The word list to fill; it keeps the shard mappings alive.
+ * @param shardFilenames The shard files, in merge order.
+ * @param progress Counters updated as the shards are parsed, or null.
+ * @param timings Receives one line per shard with its word count, size, and load time.
+ * @return True if every shard was loaded, false otherwise.
+ */
+bool loadShardedWordList(WordList& wordList, const vector<string>& shardFilenames, LoadProgress* progress, string& timings) {
+    struct Shard {
+        MappedFile file;
+        vector<WordView> words;
+        HintTable hints;
+        double milliseconds;
+        bool loaded;
+    };
+    vector<Shard> shards(shardFilenames.size());
+    vector<future<void>> tasks;
+    for (size_t k = 0; k < shards.size(); k++) {
+        tasks.push_back(async(launch::async, [&, k]() {
+            chrono::steady_clock::time_point start = chrono::steady_clock::now();
+            Shard& shard = shards[k];
+            shard.loaded = shard.file.open(shardFilenames[k]);
+            if (shard.loaded) {
+                if (progress != nullptr) {
+                    progress->totalBytes += shard.file.size();
+                }
+                parseWordList(shard.words, shard.hints, shard.file.data(), shard.file.data() + shard.file.size(), progress);
+            }
+            shard.milliseconds = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+        }));
+    }
+    for (future<void>& task : tasks) {
+        task.wait();
+    }
+
+    size_t total = 0;
+    for (size_t k = 0; k < shards.size(); k++) {
+        if (!shards[k].loaded) {
+            cerr << "Failed to open file: " << shardFilenames[k] << endl;
+            return false;
+        }
+        total += shards[k].words.size();
+    }
+    wordList.words.reserve(total);
+    for (size_t k = 0; k < shards.size(); k++) {
+        Shard& shard = shards[k];
+        string name = fileBaseName(shardFilenames[k]);
+        wordList.shardNames.push_back(name.substr(0, name.find_last_of('.')));
+        wordList.shardStarts.push_back(wordList.words.size());
+        vector<uint32_t> remap(shard.hints.size());  // Shard-local hint id to shared hint id.
+        for (uint32_t id = 0; id < remap.size(); id++) {
+            remap[id] = wordList.hints.intern(shard.hints.text(id));
+        }
+        for (WordView view : shard.words) {
+            view.hintId = remap[view.hintId];
+            wordList.words.push_back(view);
+        }
+        timings += "Shard " + wordList.shardNames.back() + ": " + to_string(shard.words.size()) + " words, " + to_string(shard.file.size()) +
+                   " bytes in " + to_string(shard.milliseconds) + " ms\n";
+        wordList.shardFiles.push_back(std::move(shard.file));  // The views stay valid: moving a mapping keeps its address.
+    }
+    wordList.shardStarts.push_back(wordList.words.size());
+    normalizeWordList(wordList);  // Duplicates are dropped across shards; the first shard to list a word keeps it.
+    wordList.buildMetadata();
+    return true;
+}
+
+/**
+ * @brief Fills a word list from the list built into the binary, with no file access.
+ * The words and hints are views of static storage, so they stay valid for the life of the program.
+ * @param wordList The word list to fill.
+ * @return True if the binary has a non-empty built-in list, false otherwise.
+ */
+bool loadEmbeddedWordList(WordList& wordList) {
+    if (EMBEDDED_WORD_COUNT == 0) {
+        return false;
+    }
+    wordList.words.reserve(EMBEDDED_WORD_COUNT);
+    for (size_t i = 0; i < EMBEDDED_WORD_COUNT; i++) {
+        const EmbeddedWord& entry = EMBEDDED_WORDS[i];
+        WordView view = {entry.word, entry.wordLength, wordList.hints.intern(StrView(entry.hint, entry.hintLength))};
+        wordList.words.push_back(view);
+    }
+    normalizeWordList(wordList);
+    wordList.buildMetadata();
+    return true;
+}
+
+/**
+ * @brief Builds the alias table for a set of weights with Vose's method in O(n).
+ * Columns are scaled so the average weight is 1; each under-full column is topped up by an over-full one, which becomes its alias.
+ * @param weights The non-negative weight of each index.
+ */
+void AliasTable::build(const vector<double>& weights) {
+    const double THRESHOLD_SCALE = 4294967296.0;  // 2^32: a threshold of 2^32 - 1 or more keeps the column (almost) always.
+    thresholds.clear();
+    aliases.clear();
+    double total = 0.0;
+    for (double weight : weights) {
+        total += weight;
+    }
+    if (weights.empty() || total <= 0.0) {
+        return;
+    }
+    size_t count = weights.size();
+    vector<double> scaled(count);
+    vector<uint32_t> small;
+    vector<uint32_t> large;
+    for (size_t i = 0; i < count; i++) {
+        scaled[i] = weights[i] * count / total;
+        (scaled[i] < 1.0 ? small : large).push_back(static_cast<uint32_t>(i));
+    }
+    thresholds.resize(count);
+    aliases.resize(count);
+    while (!small.empty() && !large.empty()) {
+        uint32_t under = small.back();
+        uint32_t over = large.back();
+        small.pop_back();
+        thresholds[under] = static_cast<uint32_t>(scaled[under] * THRESHOLD_SCALE);
+        aliases[under] = over;
+        scaled[over] -= 1.0 - scaled[under];
+        if (scaled[over] < 1.0) {
+            large.pop_back();
+            small.push_back(over);
+        }
+    }
+    for (vector<uint32_t>* rest : {&small, &large}) {  // Leftovers are full columns (up to rounding error).
+        for (uint32_t column : *rest) {
+            thresholds[column] = numeric_limits<uint32_t>::max();
+            aliases[column] = column;  // A rejected draw lands on the column itself, so it is kept exactly.
+        }
+    }
+}
+
+/**
+ * @brief Draws an index with probability proportional to its weight, using two random numbers.
+ * @param random The generator to draw from.
+ * @return The drawn index; the table must not be empty.
+ */
+size_t AliasTable::pick(RandomGenerator& random) const {
+    size_t column = random.uniform(static_cast<uint32_t>(thresholds.size()));
+    return random.next() < thresholds[column] ? column : aliases[column];
+}
+
+/**
+ * @brief Loads selection weights for a word list from a "word,weight" sidecar file and builds their alias table.
+ * Words without an entry weigh 1; when a word appears more than once, the last entry wins, so a batch of changes
+ * can be appended to the file. Words are matched in their normalized form (trimmed and uppercased, see normalizeView()),
+ * as the loader stores them; entries with a negative or unreadable weight are ignored.
+ * Only the words played are weighted: a shard's words when games are limited to one (as in scheduleWord()), otherwise the
+ * whole list. Besides the table over all of them, one table is built per difficulty shape, over the words matching it.
+ * @param weights The weights to fill.
+ * @param snapshot The word list the weights apply to; the weights keep it alive.
+ * @param filename The path to the sidecar file.
+ * @param shard The shard games are limited to, or empty for the whole list.
+ * @param notes Receives a note naming the sidecar's words that are not among the words played, for the main thread to print.
+ * @return True if the sidecar changes the weight of at least one word played and leaves some word a positive weight,
+ *         false otherwise (selection then stays with the shuffle bag).
+ */
+bool loadWordWeights(WordWeights& weights, const WordListSnapshot& snapshot, const string& filename, const string& shard, string& notes) {
+    const WordList& wordList = *snapshot;
+    size_t begin = 0;
+    size_t end = wordList.size();
+    if (!shard.empty() && (!wordList.shardRange(shard, begin, end) || end == begin)) {
+        begin = 0;  // As in scheduleWord(): an unknown (or empty) shard plays the whole list.
+        end = wordList.size();
+    }
+    MappedFile file;
+    if (!file.open(filename)) {
+        return false;
+    }
+    unordered_map<StrView, double, StrViewHash> weightOfWord;
+    TextArena arena;  // Normalized copies of sidecar words that had lowercase letters.
+    size_t rewritten = 0;
+    auto readRow = [&](const char* line, const char* comma, const char* lineEnd) {
+        string text(comma + 1, lineEnd);  // Copied so strtod sees a terminated string.
+        char* parsedEnd;
+        double weight = strtod(text.c_str(), &parsedEnd);
+        StrView word = normalizeView(StrView(line, comma - line), arena, rewritten);
+        if (parsedEnd != text.c_str() && weight >= 0.0 && word.size > 0) {
+            weightOfWord[word] = weight;
+        }
+    };
+    forEachRow(file.data(), file.data() + file.size(), readRow);
+
+    vector<double> wordWeights(end - begin, 1.0);  // Weight of each word played, by index from begin.
+    size_t changed = 0;                             // Words whose weight differs from the default.
+    unordered_set<StrView, StrViewHash> matched;    // Sidecar words found among the words played.
+    if (!weightOfWord.empty()) {
+        for (size_t i = begin; i < end; i++) {
+            unordered_map<StrView, double, StrViewHash>::const_iterator found = weightOfWord.find(wordList.word(i));
+            if (found != weightOfWord.end()) {
+                wordWeights[i - begin] = found->second;
+                changed += (found->second != 1.0) ? 1 : 0;
+                matched.insert(found->first);
+            }
+        }
+    }
+    if (matched.size() < weightOfWord.size()) {
+        const size_t LISTED = 5;  // Unmatched words named in the note; the rest are only counted.
+        notes = "The weights in " + filename + " name " + to_string(weightOfWord.size() - matched.size()) + " words that are not played:";
+        size_t listed = 0;
+        for (const pair<const StrView, double>& entry : weightOfWord) {
+            if (matched.count(entry.first) == 0 && listed++ < LISTED) {
+                notes += " " + entry.first.str();
+            }
+        }
+        notes += (listed > LISTED) ? " ...\n" : "\n";
+    }
+    if (changed == 0) {
+        return false;
+    }
+    weights.all.words.resize(end - begin);
+    for (size_t i = begin; i < end; i++) {
+        weights.all.words[i - begin] = static_cast<uint32_t>(i);
+    }
+    weights.all.table.build(wordWeights);
+    for (int maxGuesses : {8, 4, 2}) {
+        WordShape shape = difficultyWordShape(maxGuesses);
+        size_t matching = wordList.shapes.count(shape, begin, end);
+        if (matching == 0) {
+            continue;
+        }
+        weights.shapes.push_back(WeightedWords());
+        WeightedWords& shapeWeights = weights.shapes.back();
+        shapeWeights.shape = shape;
+        vector<double> matchingWeights(matching);
+        for (size_t n = 0; n < matching; n++) {
+            shapeWeights.words.push_back(static_cast<uint32_t>(wordList.shapes.nth(shape, begin, end, n)));
+            matchingWeights[n] = wordWeights[shapeWeights.words.back() - begin];
+        }
+        shapeWeights.table.build(matchingWeights);
+    }
+    weights.wordList = snapshot;
+    weights.shard = shard;
+    return !weights.all.table.empty();
+}
+
+/**
+ * @brief Picks one row of a CSV word list uniformly at random in a single streaming pass (reservoir sampling).
+ * Row k replaces the current pick with probability 1/k, so only the current pick is kept in memory
+ * and the file is never loaded as a whole. Rows whose word is empty once trimmed are skipped, as normalizeWordList() drops them;
+ * duplicate words are not (that would take a set of every word), so a word listed twice is twice as likely.
+ * Nothing is printed on failure: the caller may still fall back to the built-in list.
+ * @param filename The path to the CSV file.
+ * @param random The generator to draw from.
+ * @param word Receives the chosen word.
+ * @param hint Receives the chosen word's hint.
+ * @return True if a row was picked, false if the file could not be opened or has no rows with a word.
+ */
+bool pickRandomRow(const string& filename, RandomGenerator& random, string& word, string& hint) {
+    MappedFile file;
+    if (!file.open(filename)) {
+        return false;
+    }
+    uint32_t rowCount = 0;
+    const char* pickLine = nullptr;
+    const char* pickComma = nullptr;
+    const char* pickEnd = nullptr;
+    auto sampleRow = [&](const char* line, const char* comma, const char* lineEnd) {
+        if (trimView(StrView(line, comma - line)).size == 0) {
+            return;  // Not a playable word
+        }
+        rowCount++;
+        if (random.uniform(rowCount) == 0) {  // Keep this row with probability 1/rowCount.
+            pickLine = line;
+            pickComma = comma;
+            pickEnd = lineEnd;
+        }
+    };
+    forEachRow(file.data(), file.data() + file.size(), sampleRow);
+    if (rowCount == 0) {
+        return false;
+    }
+    word.assign(pickLine, pickComma);
+    hint.assign(pickComma + 1, pickEnd);
+    return true;
+}
+
+/**
+ * @brief Picks one random word for a single game without building the full word list.
+ * With an up-to-date compiled list the pick is a direct jump to a random row of its offset table;
+ * otherwise the CSV is streamed once with pickRandomRow(), and without a CSV the word comes from the built-in list.
+ * @param compiledFilename The path to the compiled list.
+ * @param csvFilename The path to the CSV file.
+ * @param random The generator to draw from.
+ * @param word Receives the chosen word.
+ * @param hint Receives the chosen word's hint.
+ * @return True if a word was picked, false otherwise.
+ */
+bool pickRandomWord(const string& compiledFilename, const string& csvFilename, RandomGenerator& random, string& word, string& hint) {
+    WordList compiled;
+    if (loadCompiledWordList(compiled, compiledFilename, csvFilename) && !compiled.empty()) {
+        size_t wordIndex = random.uniform(static_cast<uint32_t>(compiled.size()));
+        word = compiled.word(wordIndex).str();
+        hint = compiled.hint(wordIndex).str();
+        return true;
+    }
+    if (pickRandomRow(csvFilename, random, word, hint)) {
+        return true;
+    }
+    uint64_t size;
+    int64_t modified;
+    if (EMBEDDED_WORD_COUNT == 0 || fileSignature(csvFilename, size, modified)) {
+        return false;
+    }
+    const EmbeddedWord& entry = EMBEDDED_WORDS[random.uniform(static_cast<uint32_t>(EMBEDDED_WORD_COUNT))];
+    word.assign(entry.word, entry.wordLength);
+    hint.assign(entry.hint, entry.hintLength);
+    return true;
+}
+
+/**
+ * @brief Finds every live row of a word in a word list file and counts its rows, in one pass over a mapping of the file.
+ * Rows are compared in their normalized form, so a row stored as " apple" is found as APPLE, as the loader would read it.
+ * All of them are returned because the loader keeps the first of any duplicates, so deleting only that one would bring
+ * the next back into play.
+ * @param filename The path to the word list.
+ * @param word The normalized word to look for.
+ * @param offsets Receives the byte offsets of the word's rows, in file order; empty when the word is not in the list.
+ * @param rowCount Receives the number of rows in the file, deleted ones included.
+ * @param tombstoneCount Receives the number of deleted rows.
+ * @return True if the file could be read, false otherwise.
+ */
+bool findWordRows(const string& filename, const string& word, vector<uint64_t>& offsets, size_t& rowCount, size_t& tombstoneCount) {
+    MappedFile file;
+    if (!file.open(filename)) {
+        return false;
+    }
+    offsets.clear();
+    rowCount = 0;
+    tombstoneCount = 0;
+    const char* end = file.data() + file.size();
+    for (const char* line = file.data(); line < end;) {
+        const char* lineEnd = static_cast<const char*>(memchr(line, '\n', end - line));
+        lineEnd = (lineEnd == nullptr) ? end : lineEnd;
+        if (lineEnd > line) {  // Empty lines are not rows.
+            rowCount++;
+            const char* comma = static_cast<const char*>(memchr(line, ',', lineEnd - line));
+            if (*line == TOMBSTONE_MARKER) {
+                tombstoneCount++;
+            } else if (comma != nullptr && matchesNormalized(StrView(line, comma - line), StrView(word.data(), word.size()))) {
+                offsets.push_back(line - file.data());
+            }
+        }
+        line = lineEnd + 1;
+    }
+    return true;
+}
+
+/**
+ * @brief Deletes rows of a word list file by overwriting their first bytes with TOMBSTONE_MARKER, leaving the rest of the file as is.
+ * The tombstones are synced to disk once, after all of them are written.
+ * They are written in place, so a published snapshot parsed from this file sees them through its mapping (see
+ * MappedFile::open()): the deleted word's view starts with '#' until the watcher publishes the reloaded list.
+ * Games in progress are unaffected, as a game copies its word when it starts.
+ * @param filename The path to the word list.
+ * @param offsets The byte offsets of the rows to delete.
+ * @return True if every tombstone was written, false otherwise.
  */
-void clearScreen() {
-    // Clear the screen by printing enough newlines.
-    cout << string(100, '\n');
+bool tombstoneRows(const string& filename, const vector<uint64_t>& offsets) {
+#ifdef HANGMAN_HAVE_MMAP
+    int fd = ::open(filename.c_str(), O_WRONLY);
+    bool written = fd >= 0;
+    for (size_t i = 0; written && i < offsets.size(); i++) {
+        written = pwrite(fd, &TOMBSTONE_MARKER, 1, static_cast<off_t>(offsets[i])) == 1;
+    }
+    written = written && fsync(fd) == 0;
+    if (fd >= 0) {
+        ::close(fd);
+    }
+#else
+    fstream file(filename, ios::in | ios::out | ios::binary);
+    bool written = static_cast<bool>(file);
+    for (size_t i = 0; written && i < offsets.size(); i++) {
+        written = file.seekp(offsets[i]) && file.put(TOMBSTONE_MARKER);
+    }
+    written = written && file.flush();
+#endif
+    if (!written) {
+        cerr << "Failed to delete word in file: " << filename << endl;
+    }
+    return written;
 }
 
 /**
- * @brief Converts a given string to uppercase to standardize user input and facilitate case-insensitive comparisons.
- * Range-based for loop is used to iterate over an unknown number of characters, a nifty feature of C++11 to simplify string manipulation.
- * @param str The string to be converted to uppercase. The conversion is done in-place using a reference to avoid unnecessary copying.
+ * @brief Rewrites a word list file without its deleted rows.
+ * The live rows are written to a temporary file that then replaces the list with a rename, so readers (including the
+ * reload watcher) only ever see the old or the new file, never a partial one. The temporary file is synced before the
+ * rename and the directory after it, so a crash cannot leave the list renamed to a file whose contents never reached the disk.
+ * @param filename The path to the word list.
+ * @return True if the list was compacted, false otherwise.
  */
-void convertToUpper(string& str) {
-    for (char& c : str) {
-        c = toupper(c);
+bool compactWordList(const string& filename) {
+    MappedFile file;
+    if (!file.open(filename)) {
+        return false;
+    }
+    string compacted;  // The live rows, written in one go.
+    compacted.reserve(file.size());
+    bool needSeparator = false;  // Rows keep the list's layout: separated by '\n', with no newline after the last one.
+    const char* end = file.data() + file.size();
+    for (const char* line = file.data(); line < end;) {
+        const char* lineEnd = static_cast<const char*>(memchr(line, '\n', end - line));
+        lineEnd = (lineEnd == nullptr) ? end : lineEnd;
+        if (lineEnd > line && *line != TOMBSTONE_MARKER) {
+            if (needSeparator) {
+                compacted += '\n';
+            }
+            compacted.append(line, lineEnd - line);
+            needSeparator = true;
+        }
+        line = lineEnd + 1;
+    }
+    file.close();
+
+    string tempFilename = filename + ".tmp";
+#ifdef HANGMAN_HAVE_MMAP
+    int fd = ::open(tempFilename.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    bool written = fd >= 0 && writeAll(fd, compacted.data(), compacted.size()) && fsync(fd) == 0;
+    if (fd >= 0 && ::close(fd) != 0) {
+        written = false;
+    }
+    written = written && rename(tempFilename.c_str(), filename.c_str()) == 0 && syncDirectory(fileDirectory(filename));
+#else
+    ofstream outputFile(tempFilename, ios::binary | ios::trunc);
+    bool written = outputFile.write(compacted.data(), compacted.size()) && outputFile.flush();
+    outputFile.close();
+    written = written && rename(tempFilename.c_str(), filename.c_str()) == 0;
+#endif
+    if (!written) {
+        cerr << "Failed to compact word list: " << filename << endl;
+        remove(tempFilename.c_str());
+        return false;
     }
+    return true;
 }
 
+#ifdef HANGMAN_HAVE_MMAP
 /**
- * @brief Prompts the user for a single character input and validates it against a string of acceptable characters.
- * Repeatedly prompts until a valid character is entered, which is then returned as the user's choice.
- * @param prompt The message displayed to the user asking for input.
- * @param validOptions A string containing all acceptable characters for input validation.
- * @return The validated character input by the user.
+ * @brief Writes a whole buffer to a file descriptor, continuing after short writes.
+ * @param fd The file descriptor to write to.
+ * @param data The bytes to write.
+ * @param size The number of bytes to write.
+ * @return True if every byte was written, false on an error.
  */
-char getValidatedInput(const string& prompt, const string& validOptions) {
-    string input;
-    cout << prompt;
-    while (true) {
-        getline(cin, input);  // Using getline to handle full strings
-
-        if (isdigit(input[0]) && validOptions.find(input[0]) != string::npos) {
-            return input[0];  // If the input is a number and is not the end of a string, return it.
-        }
-        if (input.length() == 1 && (validOptions.find(toupper(input[0])) != string::npos || input[0] == '1')) {
-            return toupper(input[0]);  // If the input is a single character and in the valid options, return it.
-        } else {                       // If the input is invalid, prompt the user again.
-            cout << "Invalid response.\nPlease enter only one of\n [" << validOptions << "]\nor '1' to guess the entire word.\n>>> ";
+bool writeAll(int fd, const char* data, size_t size) {
+    for (size_t done = 0; done < size;) {
+        ssize_t count = ::write(fd, data + done, size - done);
+        if (count <= 0) {
+            return false;
         }
+        done += static_cast<size_t>(count);
     }
+    return true;
 }
 
-// =========== WORD LIST FUNCTIONS ============ //
-
 /**
- * @brief Displays all words and their associated hints from a specified file.
- * Reads each line from the file and prints it, handling file access errors gracefully.
- * @param filename The path to the file containing words and hints.
+ * @brief Flushes a directory's entries to disk, so a file just created or renamed in it survives a crash.
+ * @param path The path to the directory.
+ * @return True if the directory was synced, false otherwise.
  */
-void displayWords(const string& filename) {
-    ifstream inputFile(filename);
-    if (!inputFile) {
-        cerr << "Failed to open file for reading: " << filename << endl;
-        return;
-    }
-    string line;
-    cout << "Existing Words and Hints:\n";
-    while (getline(inputFile, line)) {
-        cout << line << endl;
+bool syncDirectory(const string& path) {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
     }
-    inputFile.close();
+    bool synced = fsync(fd) == 0;
+    ::close(fd);
+    return synced;
 }
+#endif
 
 /**
- * @brief Appends a new word and its hint to the specified file.
- * Prompts the user for a word and a hint, then writes them to the file, ensuring data consistency by converting to uppercase.
- * @param filename The path to the file where the new word and hint are appended.
+ * @brief Prompts for a word and deletes it from the word list, with a tombstone on each of its rows.
+ * @param filename The path to the word list.
+ * @return True if the deleted rows now pass the compaction threshold, false otherwise.
  */
-void appendWord(const string& filename) {
-    ofstream outputFile(filename, ios::app);  // Open the file in append mode
-    if (!outputFile) {
-        cerr << "Failed to open file for appending: " << filename << endl;
-        return;
-    }
+bool deleteWord(const string& filename) {
     string word;
-    string hint;
-    cout << "Enter a new word: ";
-    getline(cin, word);  // Use getline to allow spaces in the word
-    cout << "Enter a hint for the word: ";
-    getline(cin, hint);  // Use getline to allow spaces in the hint
-
-    convertToUpper(word);  // Convert the word to uppercase for consistency
-    convertToUpper(hint);  // Convert the hint to uppercase for consistency
+    cout << "Enter the word to delete: ";
+    getline(cin, word);
+    normalizeText(word);
 
-    // Ensure to start a new line if the file is not empty
-    outputFile << "\n"
-               << word << "," << hint;
-    cout << "New word and hint added successfully.\n";
-    outputFile.close();  // Close the file to flush changes
+    vector<uint64_t> offsets;
+    size_t rowCount;
+    size_t tombstoneCount;
+    if (!findWordRows(filename, word, offsets, rowCount, tombstoneCount)) {
+        return false;
+    }
+    if (offsets.empty()) {
+        cout << "The word " << word << " is not in the list.\n";
+        return false;
+    }
+    if (!tombstoneRows(filename, offsets)) {
+        return false;
+    }
+    cout << "Word deleted successfully.\n";
+    return (tombstoneCount + offsets.size()) * 100 > rowCount * COMPACTION_THRESHOLD_PERCENT;
 }
 
 /**
- * @brief Reads words and hints from a file into a vector, parsing each line into a wordItem struct.
- * Ensures that each word and hint is correctly stored in the vector for game use.
- * @param wordList A reference to the vector where the words and hints will be stored.
- * @param filename The path to the file containing the words and hints.
+ * @brief Prompts for a word and replaces it (and its hint) in the word list.
+ * The old rows (the word and any duplicates of it) are deleted with tombstones and the new one appended,
+ * so the file is never rewritten in place.
+ * The new word is refused when another live row already holds it, so an edit cannot create a duplicate.
+ * @param filename The path to the word list.
+ * @return True if the deleted rows now pass the compaction threshold, false otherwise.
  */
-void readIntoWordItem(vector<WordItem>& wordList, const string& filename) {
-    ifstream inputFile(filename);
-    if (!inputFile) {
-        cerr << "Failed to open file: " << filename << endl;
-        return;
+bool editWord(const string& filename) {
+    string word;
+    cout << "Enter the word to edit: ";
+    getline(cin, word);
+    normalizeText(word);
+
+    vector<uint64_t> offsets;
+    size_t rowCount;
+    size_t tombstoneCount;
+    if (!findWordRows(filename, word, offsets, rowCount, tombstoneCount)) {
+        return false;
     }
-    string line;
-    while (getline(inputFile, line)) {
-        size_t delimiterPos = line.find(',');
-        if (delimiterPos != string::npos) {
-            WordItem item;
-            item.word = line.substr(0, delimiterPos);
-            item.hint = line.substr(delimiterPos + 1);
-            wordList.push_back(item);
-        }
+    if (offsets.empty()) {
+        cout << "The word " << word << " is not in the list.\n";
+        return false;
+    }
+    string newWord;
+    string newHint;
+    cout << "Enter the new word: ";
+    getline(cin, newWord);
+    cout << "Enter the new hint: ";
+    getline(cin, newHint);
+    normalizeText(newWord);
+    normalizeText(newHint);
+    if (!isValidWord(newWord) || newHint.empty()) {
+        cout << "Words may only contain the letters A-Z and need a hint.\n";
+        return false;
+    }
+    vector<uint64_t> existingOffsets;
+    size_t existingRowCount;
+    size_t existingTombstoneCount;
+    if (!findWordRows(filename, newWord, existingOffsets, existingRowCount, existingTombstoneCount)) {
+        return false;
+    }
+    if (newWord != word && !existingOffsets.empty()) {
+        cout << "The word " << newWord << " is already in the list.\n";
+        return false;
     }
+
+    ofstream outputFile(filename, ios::app);  // Append the new row first, so the word is never missing from the list
+    if (!(outputFile << "\n" << newWord << "," << newHint) || !outputFile.flush() || !tombstoneRows(filename, offsets)) {
+        cerr << "Failed to edit word in file: " << filename << endl;
+        return false;
+    }
+    cout << "Word edited successfully.\n";
+    return (tombstoneCount + offsets.size()) * 100 > (rowCount + 1) * COMPACTION_THRESHOLD_PERCENT;
 }
 
 /**
- * @brief Provides a menu system for managing the word list, allowing viewing and addition of words.
+ * @brief Provides a menu system for managing the word list, allowing viewing, searching, addition, bulk import, deletion, and editing of words.
+ * Deleted rows are compacted away on a background thread once they pass COMPACTION_THRESHOLD_PERCENT of the list.
  * Validates user input to navigate through the options of viewing words, adding new ones, or returning to the main menu.
  * @param filename The path to the file used for word storage and retrieval.
  */
 void manageWordList(const string& filename) {
     bool continueManagement = true;  // Flag to keep
-    string validOptions = "123";     // Valid options for management menu
+    string validOptions = "1234567";  // Valid options for management menu
+    WordListIndex index;             // Line-offset index for the viewer, rebuilt only when the file changes
+    thread compactor;                // Background compaction of deleted rows, joined before the file is touched again
+    bool compact = false;            // Whether the last change passed the compaction threshold
 
     while (continueManagement) {
         clearScreen();  // Clears the screen for better readability
         cout << "Word List Management:\n";
         cout << "1. View Words\n";
         cout << "2. Add Word\n";
-        cout << "3. Return to Main Menu\n";
+        cout << "3. Import Words\n";
+        cout << "4. Delete Word\n";
+        cout << "5. Edit Word\n";
+        cout << "6. Search Words\n";
+        cout << "7. Return to Main Menu\n";
 
-        char choice = getValidatedInput("Choose an option (1-View, 2-Add, 3-Return):\n>>> ", validOptions);  // Get user input
+        char choice = getValidatedInput("Choose an option (1-View, 2-Add, 3-Import, 4-Delete, 5-Edit, 6-Search, 7-Return):\n>>> ", validOptions);  // Get user input
+        string sourceFilename;
+        if (compactor.joinable()) {
+            compactor.join();  // Let a running compaction finish before the file is read or changed again
+        }
         switch (choice) {
             case '1':
-                displayWords(filename);  // Display the words and hints
+                displayWords(filename, index);  // Page through the words and hints
                 break;
             case '2':
                 appendWord(filename);  // Append a new word and hint to the file
                 break;
             case '3':
+                cout << "Enter the file to import (one \"word,hint\" per line): ";
+                getline(cin, sourceFilename);
+                importWords(filename, sourceFilename);  // Append every new word of the file in one batch
+                break;
+            case '4':
+                compact = deleteWord(filename);  // Delete the word with a tombstone
+                break;
+            case '5':
+                compact = editWord(filename);  // Replace the word with a tombstone and a new row
+                break;
+            case '6':
+                searchWords(filename, index);  // Look up words by prefix or pattern
+                break;
+            case '7':
                 continueManagement = false;  // Break the loop to return to the main menu;
                 break;
             default:
                 cout << "Invalid option selected. Please try again.\n";  // Display an error message for invalid input
         }
 
-        if (choice == '1' || choice == '2') {
+        if (compact) {
+            compactor = thread(compactWordList, filename);  // Rewrite the list without its deleted rows in the background
+            compact = false;
+        }
+        if (choice != '1' && choice != '7') {
             cout << "\nPress enter to continue...";
             clearInputBuffer();  // Wait for user input before continuing
         }
     }
+    if (compactor.joinable()) {
+        compactor.join();
+    }
 }
 
-// =========== GAME FUNCTIONS ============ //
+// =========== ENGINE FUNCTIONS ============ //
+
+/**
+ * @brief Starts a new game on a state, keeping the state's round statistics.
+ * The engine functions below do no I/O and allocate nothing per guess, so games can be driven headlessly;
+ * the console modes are front-ends that print what they report.
+ * @param state The game state to reset.
+ * @param word The uppercase word to be guessed; copied into the state.
+ * @param hint The word's hint; must outlive the game.
+ * @param maxGuesses The number of incorrect guesses allowed.
+ */
+void newGame(GameState& state, const StrView& word, const StrView& hint, int maxGuesses) {
+    newGame(state, word, hint, maxGuesses, letterMask(word));
+}
+
+/**
+ * @brief Starts a new game on a state with a letter mask computed in advance, such as WordList::letterMask().
+ * @param state The game state to reset.
+ * @param word The uppercase word to be guessed; copied into the state.
+ * @param hint The word's hint; must outlive the game.
+ * @param maxGuesses The number of incorrect guesses allowed.
+ * @param wordMask The letters of the word, as returned by letterMask().
+ */
+void newGame(GameState& state, const StrView& word, const StrView& hint, int maxGuesses, uint32_t wordMask) {
+    state.chosenWord.assign(word.data, word.size);  // Reuses the state's buffer from the previous game.
+    state.chosenHint = hint;
+    state.maxGuesses = maxGuesses;
+    state.incorrectGuesses = 0;
+    state.wordGuessed = (wordMask == 0);  // A word without letters is already solved, as in the GameSession engine.
+    state.guessCount = 0;
+    state.wordMask = wordMask;
+    state.guessedMask = 0;
+    state.remainingMask = wordMask;
+}
+
+/**
+ * @brief Guesses a single letter. The duplicate check, the hit test, and the win check are each a single operation on the letter masks.
+ * @param state The game to update.
+ * @param letter The uppercase letter guessed.
+ * @return The result of the guess and the game's status after it.
+ */
+GuessEvent guessLetter(GameState& state, char letter) {
+    GuessEvent event = {GUESS_HIT, gameStatus(state), 0, state.maxGuesses - state.incorrectGuesses};
+    uint32_t guessBit = letterBit(letter);
+    if (event.status != GAME_IN_PROGRESS) {
+        event.result = GUESS_GAME_OVER;
+    } else if (guessBit == 0) {
+        event.result = GUESS_INVALID;
+    } else if ((state.guessedMask & guessBit) != 0) {
+        event.result = GUESS_REPEATED;
+    } else {
+        state.guessedMask |= guessBit;
+        state.guessOrder[state.guessCount++] = letter;
+        event.revealed = state.remainingMask & guessBit;
+        if (event.revealed == 0) {
+            event.result = GUESS_MISS;
+            state.incorrectGuesses++;
+        } else {
+            state.remainingMask &= ~guessBit;
+            state.wordGuessed = (state.remainingMask == 0);
+        }
+        event.status = gameStatus(state);
+        event.guessesLeft = state.maxGuesses - state.incorrectGuesses;
+    }
+    return event;
+}
+
+/**
+ * @brief Guesses the whole word. A wrong word guess ends the game as a loss.
+ * @param state The game to update.
+ * @param word The uppercase word guessed.
+ * @return The result of the guess and the game's status after it.
+ */
+GuessEvent guessWord(GameState& state, const StrView& word) {
+    GuessEvent event = {GUESS_GAME_OVER, gameStatus(state), 0, state.maxGuesses - state.incorrectGuesses};
+    if (event.status != GAME_IN_PROGRESS) {
+        return event;
+    }
+    if (word == StrView(state.chosenWord.data(), state.chosenWord.size())) {
+        event.result = GUESS_HIT;
+        event.revealed = state.remainingMask;
+        state.remainingMask = 0;
+        state.wordGuessed = true;
+    } else {
+        event.result = GUESS_MISS;
+        state.incorrectGuesses = state.maxGuesses;  // Set incorrect guesses to max to end the game.
+    }
+    event.status = gameStatus(state);
+    event.guessesLeft = state.maxGuesses - state.incorrectGuesses;
+    return event;
+}
+
+/**
+ * @brief Reports whether a game is still being played.
+ * @param state The game to inspect.
+ * @return GAME_WON once the word is guessed, GAME_LOST once the incorrect guesses run out, otherwise GAME_IN_PROGRESS.
+ */
+GameStatus gameStatus(const GameState& state) {
+    if (state.wordGuessed) {
+        return GAME_WON;
+    }
+    return (state.incorrectGuesses >= state.maxGuesses) ? GAME_LOST : GAME_IN_PROGRESS;
+}
+
+/**
+ * @brief Starts a new compact game on a word of a list.
+ * @param session The session to reset.
+ * @param wordList The list the word comes from; later word guesses must be checked against the same list.
+ * @param wordId The index of the word in the list.
+ * @param maxGuesses The number of incorrect guesses allowed, at most 255.
+ */
+void newGame(GameSession& session, const WordList& wordList, uint32_t wordId, int maxGuesses) {
+    session.wordId = wordId;
+    session.guessedMask = 0;
+    session.remainingMask = wordList.letterMask(wordId);
+    session.incorrectGuesses = 0;
+    session.maxGuesses = static_cast<uint8_t>(min(maxGuesses, 255));
+    session.status = (session.remainingMask == 0) ? GAME_WON : GAME_IN_PROGRESS;  // A word without letters is already solved.
+    session.reserved = 0;
+}
+
+/**
+ * @brief Guesses a single letter in a compact game, with the same rules as guessLetter() on a GameState.
+ * @param session The game to update.
+ * @param letter The uppercase letter guessed.
+ * @return The result of the guess and the game's status after it.
+ */
+GuessEvent guessLetter(GameSession& session, char letter) {
+    GuessEvent event = {GUESS_HIT, gameStatus(session), 0, session.maxGuesses - session.incorrectGuesses};
+    uint32_t guessBit = letterBit(letter);
+    if (event.status != GAME_IN_PROGRESS) {
+        event.result = GUESS_GAME_OVER;
+    } else if (guessBit == 0) {
+        event.result = GUESS_INVALID;
+    } else if ((session.guessedMask & guessBit) != 0) {
+        event.result = GUESS_REPEATED;
+    } else {
+        session.guessedMask |= guessBit;
+        event.revealed = session.remainingMask & guessBit;
+        if (event.revealed == 0) {
+            event.result = GUESS_MISS;
+            if (++session.incorrectGuesses >= session.maxGuesses) {
+                session.status = GAME_LOST;
+            }
+        } else {
+            session.remainingMask &= ~guessBit;
+            if (session.remainingMask == 0) {
+                session.status = GAME_WON;
+            }
+        }
+        event.status = gameStatus(session);
+        event.guessesLeft = session.maxGuesses - session.incorrectGuesses;
+    }
+    return event;
+}
+
+/**
+ * @brief Guesses the whole word in a compact game. A wrong word guess ends the game as a loss.
+ * @param session The game to update.
+ * @param wordList The list the game was started from.
+ * @param word The uppercase word guessed.
+ * @return The result of the guess and the game's status after it.
+ */
+GuessEvent guessWord(GameSession& session, const WordList& wordList, const StrView& word) {
+    GuessEvent event = {GUESS_GAME_OVER, gameStatus(session), 0, session.maxGuesses - session.incorrectGuesses};
+    if (event.status != GAME_IN_PROGRESS) {
+        return event;
+    }
+    if (word == wordList.word(session.wordId)) {
+        event.result = GUESS_HIT;
+        event.revealed = session.remainingMask;
+        session.remainingMask = 0;
+        session.status = GAME_WON;
+    } else {
+        event.result = GUESS_MISS;
+        session.incorrectGuesses = session.maxGuesses;
+        session.status = GAME_LOST;
+    }
+    event.status = gameStatus(session);
+    event.guessesLeft = session.maxGuesses - session.incorrectGuesses;
+    return event;
+}
+
+/**
+ * @brief Reports whether a compact game is still being played.
+ * @param session The game to inspect.
+ * @return The game's status.
+ */
+GameStatus gameStatus(const GameSession& session) {
+    return static_cast<GameStatus>(session.status);
+}
+
+/**
+ * @brief Resizes the table, keeping the games that fit.
+ * @param count The number of games the table holds.
+ */
+void SessionTable::resize(size_t count) {
+    wordIds.resize(count, 0);
+    guessedMasks.resize(count, 0);
+    remainingMasks.resize(count, 0);
+    incorrectGuesses.resize(count, 0);
+    maxGuesses.resize(count, 0);
+    statuses.resize(count, GAME_LOST);  // Not started, so guesses are ignored.
+}
+
+/**
+ * @brief Starts a new game in a slot of the table.
+ * @param id The slot to reset.
+ * @param wordList The list the word comes from.
+ * @param wordId The index of the word in the list.
+ * @param maxGuesses The number of incorrect guesses allowed, at most 255.
+ */
+void SessionTable::newGame(SessionId id, const WordList& wordList, uint32_t wordId, int maxGuesses) {
+    GameSession session;
+    ::newGame(session, wordList, wordId, maxGuesses);
+    wordIds[id] = session.wordId;
+    guessedMasks[id] = session.guessedMask;
+    remainingMasks[id] = session.remainingMask;
+    incorrectGuesses[id] = session.incorrectGuesses;
+    this->maxGuesses[id] = session.maxGuesses;
+    statuses[id] = session.status;
+}
+
+/**
+ * @brief Applies a batch of letter guesses with the rules of guessLetter(): repeated and invalid letters cost nothing,
+ * and guesses in games that are over are ignored. A game may appear more than once in a batch; its guesses apply in order.
+ * Runs of consecutive ids, as in a tick where every game guesses once, are applied eight games at a time with AVX2 when the CPU has it.
+ * @param ids The game of each guess.
+ * @param letters The uppercase letter of each guess.
+ * @param count The number of guesses.
+ */
+void SessionTable::applyGuesses(const SessionId* ids, const char* letters, size_t count) {
+    const size_t MIN_RUN = 16;  // Shorter runs are applied one guess at a time.
+    GuessRunApplier applyGuessRun = selectGuessRunApplier();
+    size_t i = 0;
+    while (i < count) {
+        size_t run = 1;
+        while (i + run < count && ids[i + run] == ids[i] + run) {
+            run++;
+        }
+        if (run >= MIN_RUN) {
+            SessionId first = ids[i];
+            applyGuessRun(&guessedMasks[first], &remainingMasks[first], &incorrectGuesses[first], &maxGuesses[first], &statuses[first],
+                          letters + i, run);
+        } else {
+            for (size_t end = i + run; i < end; i++) {
+                applyGuess(ids[i], letters[i]);
+            }
+            continue;
+        }
+        i += run;
+    }
+}
+
+/**
+ * @brief Applies one guess. Every outcome is computed with masks and selects rather than branches.
+ * @param id The game.
+ * @param letter The uppercase letter guessed.
+ */
+void SessionTable::applyGuess(SessionId id, char letter) {
+    uint32_t offset = static_cast<uint32_t>(static_cast<unsigned char>(letter)) - 'A';
+    uint32_t bit = (1u << (offset & 31)) & (0u - static_cast<uint32_t>(offset < 26));  // 0 for anything but 'A' to 'Z'
+    uint32_t active = 0u - static_cast<uint32_t>(statuses[id] == GAME_IN_PROGRESS);
+    uint32_t fresh = bit & ~guessedMasks[id] & active;  // The letter's bit for a new guess in a game in progress, else 0
+    uint32_t hit = fresh & remainingMasks[id];
+    guessedMasks[id] |= fresh;
+    remainingMasks[id] &= ~hit;
+    incorrectGuesses[id] = static_cast<uint8_t>(incorrectGuesses[id] + static_cast<uint8_t>(fresh != 0 && hit == 0));
+    uint8_t outcome = (remainingMasks[id] == 0) ? GAME_WON : (incorrectGuesses[id] >= maxGuesses[id]) ? GAME_LOST : GAME_IN_PROGRESS;
+    statuses[id] = active != 0 ? outcome : statuses[id];
+}
+
+/**
+ * @brief Copies a game out of the table, for reporting or to continue it on its own.
+ * @param id The game to copy.
+ * @return The game as a GameSession.
+ */
+GameSession SessionTable::session(SessionId id) const {
+    GameSession session;
+    session.wordId = wordIds[id];
+    session.guessedMask = guessedMasks[id];
+    session.remainingMask = remainingMasks[id];
+    session.incorrectGuesses = incorrectGuesses[id];
+    session.maxGuesses = maxGuesses[id];
+    session.status = statuses[id];
+    session.reserved = 0;
+    return session;
+}
+
+/**
+ * @brief Applies one guess to each of a run of consecutive games, with the same arithmetic as SessionTable::applyGuess().
+ * @param guessed The guessed letters of the first game of the run, followed by those of the rest.
+ * @param remaining The unrevealed letters of the games.
+ * @param incorrect The incorrect guess counts of the games.
+ * @param allowed The incorrect guesses allowed in the games.
+ * @param status The GameStatus of the games.
+ * @param letters The letter guessed in each game.
+ * @param count The number of games in the run.
+ */
+void applyGuessRunScalar(uint32_t* guessed, uint32_t* remaining, uint8_t* incorrect, const uint8_t* allowed, uint8_t* status, const char* letters,
+                         size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        uint32_t offset = static_cast<uint32_t>(static_cast<unsigned char>(letters[i])) - 'A';
+        uint32_t bit = (1u << (offset & 31)) & (0u - static_cast<uint32_t>(offset < 26));
+        uint32_t active = 0u - static_cast<uint32_t>(status[i] == GAME_IN_PROGRESS);
+        uint32_t fresh = bit & ~guessed[i] & active;
+        uint32_t hit = fresh & remaining[i];
+        uint32_t left = remaining[i] & ~hit;
+        uint8_t wrong = static_cast<uint8_t>(incorrect[i] + (fresh != hit));  // hit is either fresh or 0
+        uint8_t won = static_cast<uint8_t>(left == 0);
+        uint8_t lost = static_cast<uint8_t>(wrong >= allowed[i]) & static_cast<uint8_t>(won ^ 1);
+        uint8_t outcome = static_cast<uint8_t>(won * GAME_WON + lost * GAME_LOST);
+        guessed[i] |= fresh;
+        remaining[i] = left;
+        incorrect[i] = wrong;
+        status[i] = static_cast<uint8_t>(status[i] ^ ((status[i] ^ outcome) & static_cast<uint8_t>(active)));
+    }
+}
+
+#ifdef HANGMAN_HAVE_X86_SIMD
+/**
+ * @brief Applies one guess to each of a run of consecutive games, eight games per step, with the arithmetic of applyGuessRunScalar().
+ * Compiled for AVX2 regardless of the build flags; only called when the CPU reports AVX2 support.
+ * @param guessed The guessed letters of the first game of the run, followed by those of the rest.
+ * @param remaining The unrevealed letters of the games.
+ * @param incorrect The incorrect guess counts of the games.
+ * @param allowed The incorrect guesses allowed in the games.
+ * @param status The GameStatus of the games.
+ * @param letters The letter guessed in each game.
+ * @param count The number of games in the run.
+ */
+__attribute__((target("avx2"))) void applyGuessRunAvx2(uint32_t* guessed, uint32_t* remaining, uint8_t* incorrect, const uint8_t* allowed,
+                                                       uint8_t* status, const char* letters, size_t count) {
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i one = _mm256_set1_epi32(1);
+    const __m256i letterA = _mm256_set1_epi32('A');
+    const __m256i won = _mm256_set1_epi32(GAME_WON);
+    const __m256i lost = _mm256_set1_epi32(GAME_LOST);
+    const __m256i lowBytes = _mm256_setr_epi8(0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,   // Byte 0 of each 32-bit lane,
+                                              0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);  // packed per 128-bit half
+    const __m256i joinHalves = _mm256_setr_epi32(0, 4, 0, 0, 0, 0, 0, 0);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i offset = _mm256_sub_epi32(_mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(letters + i))), letterA);
+        __m256i valid = _mm256_andnot_si256(_mm256_cmpgt_epi32(zero, offset), _mm256_cmpgt_epi32(_mm256_set1_epi32(26), offset));
+        __m256i bit = _mm256_and_si256(_mm256_sllv_epi32(one, offset), valid);
+        __m256i oldStatus = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(status + i)));
+        __m256i active = _mm256_cmpeq_epi32(oldStatus, zero);  // GAME_IN_PROGRESS
+        __m256i oldGuessed = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(guessed + i));
+        __m256i oldRemaining = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(remaining + i));
+        __m256i fresh = _mm256_and_si256(_mm256_andnot_si256(oldGuessed, bit), active);
+        __m256i hit = _mm256_and_si256(fresh, oldRemaining);
+        __m256i left = _mm256_andnot_si256(hit, oldRemaining);
+        __m256i wrong = _mm256_add_epi32(_mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(incorrect + i))),
+                                         _mm256_andnot_si256(_mm256_cmpeq_epi32(fresh, hit), one));
+        __m256i limit = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(allowed + i)));
+        __m256i isWon = _mm256_cmpeq_epi32(left, zero);
+        __m256i isLost = _mm256_andnot_si256(_mm256_or_si256(isWon, _mm256_cmpgt_epi32(limit, wrong)), _mm256_set1_epi32(-1));
+        __m256i outcome = _mm256_or_si256(_mm256_and_si256(isWon, won), _mm256_and_si256(isLost, lost));
+        __m256i newStatus = _mm256_blendv_epi8(oldStatus, outcome, active);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(guessed + i), _mm256_or_si256(oldGuessed, fresh));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(remaining + i), left);
+        __m256i wrongBytes = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(wrong, lowBytes), joinHalves);
+        __m256i statusBytes = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(newStatus, lowBytes), joinHalves);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(incorrect + i), _mm256_castsi256_si128(wrongBytes));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(status + i), _mm256_castsi256_si128(statusBytes));
+    }
+    applyGuessRunScalar(guessed + i, remaining + i, incorrect + i, allowed + i, status + i, letters + i, count - i);
+}
+#endif
+
+/**
+ * @brief Picks the fastest way to apply a run of guesses supported by the running CPU: AVX2, then the scalar loop.
+ * @return The chosen function.
+ */
+GuessRunApplier selectGuessRunApplier() {
+#ifdef HANGMAN_HAVE_X86_SIMD
+    if (__builtin_cpu_supports("avx2")) {
+        return applyGuessRunAvx2;
+    }
+#endif
+    return applyGuessRunScalar;
+}
 
 /**
- * @brief Calculates and updates the win and loss rates based on the game's current state.
- * Ensures accurate tracking of game statistics by updating win and loss rates after each round.
- * @param state The current game state containing the counts of won and lost rounds.
+ * @brief Adds a finished game to a player's record.
+ * @param stats The player's record.
+ * @param status The status of the game; games still in progress are not counted.
  */
-void gameStats(GameState& state) {
-    if (state.wonRounds > 0 || state.lostRounds > 0) {
-        state.totalRounds = state.wonRounds + state.lostRounds;
+void recordGameResult(PlayerStats& stats, GameStatus status) {
+    if (status == GAME_WON) {
+        stats.wonRounds++;
+    } else if (status == GAME_LOST) {
+        stats.lostRounds++;
     }
-    state.winRate = (state.totalRounds == 0) ? 0 : static_cast<double>(state.wonRounds) / state.totalRounds * 100;
-    state.lossRate = (state.totalRounds == 0) ? 0 : static_cast<double>(state.lostRounds) / state.totalRounds * 100;
 }
 
+// =========== GAME FUNCTIONS ============ //
+
 /**
  * @brief Allows the user to select a difficulty level, affecting the number of allowed incorrect guesses.
  * Prompts the user to choose among predefined difficulty levels, returning the corresponding max guesses allowed.
@@ -370,6 +4504,24 @@ int selectDifficultyLevel() {
     }
 }
 
+/**
+ * @brief Maps a difficulty level to the shape of words it selects.
+ * Long words with many distinct letters give more hits per guess, so easier levels favor them
+ * and harder levels favor short words with few distinct letters.
+ * @param maxGuesses The number of incorrect guesses allowed, as returned by selectDifficultyLevel().
+ * @return The accepted ranges of word length and distinct letters.
+ */
+WordShape difficultyWordShape(int maxGuesses) {
+    WordShape NOOB_SHAPE = {6, SHAPE_MAX_LENGTH, 5, 26};  // Long words with plenty of distinct letters.
+    WordShape INTERMEDIATE_SHAPE = {5, 9, 4, 26};          // Medium-length words.
+    WordShape VETERAN_SHAPE = {3, 6, 0, 5};                // Short words with few distinct letters.
+
+    if (maxGuesses >= 8) {
+        return NOOB_SHAPE;
+    }
+    return (maxGuesses >= 4) ? INTERMEDIATE_SHAPE : VETERAN_SHAPE;
+}
+
 /**
  * @brief Sets up the difficulty of the game by determining the maximum number of incorrect guesses allowed.
  * Uses the selected difficulty level to set the maxGuesses for the game session.
@@ -386,54 +4538,59 @@ void setupDifficulty(int& maxGuesses) {
  */
 void displayGameState(const GameState& state) {
     drawGallows(state.incorrectGuesses, state.maxGuesses);
-    cout << "Hint: " << (state.incorrectGuesses == 0 ? "" : state.chosenHint) << endl;
-    cout << "Guessed Letters: " << state.guessedLetters << endl;
+    cout << "Hint: ";
+    if (state.incorrectGuesses != 0) {
+        cout.write(state.chosenHint.data, state.chosenHint.size);  // Hints are uppercased when the list is loaded.
+    }
+    cout << endl;
+    cout << "Guessed Letters: ";
+    cout.write(state.guessOrder.data(), state.guessCount);
+    cout << endl;
     for (char letter : state.chosenWord) {
-        cout << (state.guessedLetters.find(letter) != string::npos ? letter : '_') << ' ';
+        cout << ((state.guessedMask & letterBit(letter)) != 0 ? letter : '_') << ' ';  // Only guessed letters have their bit set
     }
     cout << endl;
 }
 
 /**
- * @brief Processes a complete word guess from the user, comparing it against the chosen word in the game state.
- * Updates the game state based on whether the guess was correct or not, potentially ending the game.
+ * @brief Processes a complete word guess from the user and reports whether it matched the chosen word.
+ * A wrong guess ends the game.
  * @param state The current game state, which includes the correct word.
  * @param fullGuess The full word guessed by the user.
  * @return True if the guess was correct, otherwise false.
  */
 bool wordGuess(GameState& state, const string& fullGuess) {
-    if (fullGuess == state.chosenWord) {
-        state.wordGuessed = true;
+    GuessEvent event = guessWord(state, StrView(fullGuess.data(), fullGuess.size()));
+    if (event.result == GUESS_HIT) {
         cout << "Correct! The word was: " << state.chosenWord << endl;
         return true;
-    } else {
-        cout << "Incorrect! The correct word was: " << state.chosenWord << endl;
-        state.incorrectGuesses = state.maxGuesses;  // Set incorrect guesses to max to end the game.
-        return false;
     }
+    cout << "Incorrect! The correct word was: " << state.chosenWord << endl;
+    return false;
 }
 
 /**
- * @brief Handles the user's guess of a single letter, updating the game state based on whether the guess was correct.
- * Checks if the letter has already been guessed and updates the count of incorrect guesses if necessary.
+ * @brief Handles the user's guess of a single letter and reports the outcome.
  * @param state The current game state which will be updated.
  * @param guess The character guessed by the player.
- * @return True if the guessed letter is in the word, false if not.
+ * @return True if the guess completed the word, false otherwise.
  */
 bool handleCharacterGuess(GameState& state, char guess) {
-    if (state.guessedLetters.find(guess) != string::npos) {  // Check if the letter has already been guessed.
-        cout << "You have already guessed '" << guess << "'. No penalty." << endl;
-        return false;
-    }
-    state.guessedLetters += guess;
-    if (state.chosenWord.find(guess) == string::npos) {  // Check if the guessed letter is in the chosen word.
-        cout << '"' << guess << '"' << " is incorrect!" << endl;
-        state.incorrectGuesses++;
-        return false;  // Return false if the guessed letter is not in the chosen word.
-    } else {
-        cout << '"' << guess << '"' << " is correct!" << endl;
-        return checkWordGuessed(state);  // Check if the word has been fully guessed.
+    GuessEvent event = guessLetter(state, guess);
+    switch (event.result) {
+        case GUESS_HIT:
+            cout << '"' << guess << '"' << " is correct!" << endl;
+            break;
+        case GUESS_MISS:
+            cout << '"' << guess << '"' << " is incorrect!" << endl;
+            break;
+        case GUESS_REPEATED:
+            cout << "You have already guessed '" << guess << "'. No penalty." << endl;
+            break;
+        default:  // Input is validated and the game loops stop at game over, so these do not happen.
+            break;
     }
+    return event.status == GAME_WON;
 }
 
 /**
@@ -456,22 +4613,6 @@ bool processPlayerGuess(GameState& state) {
     }
 }
 
-/**
- * @brief Checks if the entire word has been guessed correctly based on the letters guessed so far.
- * Determines if the game has been won by checking each letter of the word against the guessed letters.
- * @param state The current game state containing the word and the guessed letters.
- * @return True if all letters in the word have been guessed, false otherwise.
- */
-bool checkWordGuessed(GameState& state) {
-    for (char letter : state.chosenWord) {                        // Check each letter in the chosen word.
-        if (state.guessedLetters.find(letter) == string::npos) {  // If the letter is not in the guessed letters string.
-            return false;                                         // Return false if any letter in the word has not been guessed yet.
-        }
-    }
-    state.wordGuessed = true;  // Set the wordGuessed flag to true if the guess is correct.
-    return true;               // If all letters have been guessed correctly, return true.
-}
-
 /**
  * @brief Draws the gallows based on the current number of incorrect guesses, depicting the player's progress towards losing.
  * Dynamically updates the gallows display to visually represent the stakes of the game as guesses are made.
@@ -508,27 +4649,23 @@ void drawGallows(int incorrectGuesses, int maxGuesses) {
 
 /**
  * @brief Displays the end of the game message, showing whether the player has won or lost and the correct word.
- * Updates game statistics and shows a detailed message regarding the game's outcome.
+ * Updates the player's statistics and shows a detailed message regarding the game's outcome.
  * @param state The final state of the game, used to determine and display the outcome.
+ * @param stats The player's record across the rounds of this session.
  */
-void endGameDisplay(GameState& state) {
+void endGameDisplay(const GameState& state, PlayerStats& stats) {
+    recordGameResult(stats, gameStatus(state));
     if (state.wordGuessed) {
-        state.wonRounds++;
         cout << "Congratulations, you've guessed the word: " << state.chosenWord << endl;
     } else if (state.incorrectGuesses >= state.maxGuesses) {
-        state.lostRounds++;
         drawGallows(state.incorrectGuesses, state.maxGuesses);
         cout << "Sorry, you've been hanged." << endl;
         cout << "The correct word was: " << state.chosenWord << "\n"
              << endl;
     }
 
-    // Only update total rounds and rates at the end of a player's game
-    state.totalRounds = state.wonRounds + state.lostRounds;
-    state.winRate = (state.totalRounds > 0) ? static_cast<double>(state.wonRounds) / state.totalRounds * 100.0 : 0.0;
-    state.lossRate = (state.totalRounds > 0) ? static_cast<double>(state.lostRounds) / state.totalRounds * 100.0 : 0.0;
-    cout << "You have won " << state.wonRounds << " rounds and lost " << state.lostRounds << " rounds.\n";
-    cout << "Win rate: " << state.winRate << "%, Loss rate: " << state.lossRate << "%" << endl;
+    cout << "You have won " << stats.wonRounds << " rounds and lost " << stats.lostRounds << " rounds.\n";
+    cout << "Win rate: " << stats.winRate() << "%, Loss rate: " << stats.lossRate() << "%" << endl;
 }
 
 /**
@@ -541,6 +4678,31 @@ bool promptToPlayAgain() {
     return (response == 'Y' || response == 'y');
 }
 
+/**
+ * @brief Blocks until the word list loaded in the background is ready, showing how many rows and bytes have been read.
+ * Returns at once when the list finished loading while the player was in the menu.
+ * Then prints the notes of the loads since the last game (timings with --verbose, fallbacks), which the loader threads
+ * leave to this thread so they never land in the middle of a prompt.
+ * Also warns when the session is limited to a shard the list does not have.
+ * @param wordStore The store loading the word list.
+ */
+void waitForWordList(const WordListStore& wordStore) {
+    if (!wordStore.waitForLoad(chrono::milliseconds(0))) {
+        const LoadProgress& progress = wordStore.progress();
+        do {
+            cout << "\rLoading words: " << progress.rows << " rows, " << progress.bytes / 1000000 << " of " << progress.totalBytes / 1000000
+                 << " MB   " << flush;
+        } while (!wordStore.waitForLoad(chrono::milliseconds(100)));
+        cout << "\rLoaded " << wordStore.snapshot()->size() << " words.                         " << endl;
+    }
+    cout << wordStore.takeMessages() << flush;
+    size_t begin;
+    size_t end;
+    if (!wordStore.shard().empty() && !wordStore.snapshot()->shardRange(wordStore.shard(), begin, end)) {
+        cerr << "There is no word list shard named " << wordStore.shard() << "; playing words from every shard." << endl;
+    }
+}
+
 // =========== SINGLEPLAYER FUNCTION ============ //
 
 /**
@@ -548,32 +4710,80 @@ bool promptToPlayAgain() {
  * This function orchestrates the singleplayer game by randomly selecting a word from the provided list,
  * initializing the game state, and managing the game loop. Players guess letters or the entire word
  * to try to solve the hangman before they run out of guesses.
- * @param wordList A vector of wordItem structures containing words and hints to be used in the game.
+ * Each round takes the latest word list snapshot and holds it until the round ends, so a reload never affects a game in progress.
+ * @param wordStore The store publishing the word list containing words and hints to be used in the game.
+ * @param random The session's generator, which picks its words.
  */
-void playSingleplayer(const vector<WordItem>& wordList) {
-    cout << "Starting the singleplayer game with " << wordList.size() << " words." << endl;
+void playSingleplayer(const WordListStore& wordStore, const RandomGenerator& random) {
+    waitForWordList(wordStore);
+    cout << "Starting the singleplayer game with " << wordStore.snapshot()->size() << " words." << endl;
     int maxGuesses;
     setupDifficulty(maxGuesses);
+    WordScheduler scheduler(random);  // No word repeats within the session until every matching word has been played.
+    PlayerStats stats;
 
     do {
+        WordListSnapshot snapshot = wordStore.snapshot();  // The hint view below points into this snapshot.
+        const WordList& wordList = *snapshot;
+        if (wordList.empty()) {
+            cerr << "No words available to play." << endl;
+            return;
+        }
         GameState state(maxGuesses);
-        int wordIndex = rand() % wordList.size();  // Randomly select a word from the list
-        state.chosenWord = wordList[wordIndex].word;
-        state.chosenHint = wordList[wordIndex].hint;
-        convertToUpper(state.chosenWord);
-        convertToUpper(state.chosenHint);
+        WordWeightsSnapshot weights = wordStore.weights();
+        size_t wordIndex = scheduleWord(wordList, weights.get(), difficultyWordShape(maxGuesses), wordStore.shard(), scheduler);  // Next word for this session
+        string decoded;  // Holds the word when it is decoded from a front-coded list
+        newGame(state, wordList.playedWord(wordIndex, decoded), wordList.playedHint(wordIndex), maxGuesses,
+                wordList.letterMask(wordIndex));  // Normalized when the list was loaded
 
         cout << "Welcome to Hangman!" << endl;
-        while (state.incorrectGuesses < state.maxGuesses && !state.wordGuessed) {  // Game loop
+        while (gameStatus(state) == GAME_IN_PROGRESS) {  // Game loop
             displayGameState(state);
             if (!processPlayerGuess(state)) {
                 cout << "You have " << state.maxGuesses - state.incorrectGuesses << " incorrect guesses remaining." << endl;
             }
         }
-        endGameDisplay(state);
+        endGameDisplay(state, stats);
     } while (promptToPlayAgain());
 }
 
+/**
+ * @brief Plays a single singleplayer game without loading the whole word list, for one-shot launches (--quick).
+ * The word is picked on a background thread while the player chooses a difficulty, so the first prompt
+ * appears immediately regardless of the size of the list.
+ * @param compiledFilename The path to the compiled list.
+ * @param csvFilename The path to the CSV file.
+ * @param random The generator that picks the word; owned by the picking thread until it is joined.
+ */
+void playQuickSingleplayer(const string& compiledFilename, const string& csvFilename, RandomGenerator random) {
+    string word;
+    string hint;
+    bool picked = false;
+    thread picker([&]() { picked = pickRandomWord(compiledFilename, csvFilename, random, word, hint); });
+    int maxGuesses;
+    setupDifficulty(maxGuesses);
+    picker.join();
+    if (!picked) {
+        cerr << "No words available to play: " << csvFilename << " could not be read." << endl;
+        return;
+    }
+
+    normalizeText(word);  // Picked straight from the file, so not normalized by a load
+    normalizeText(hint);
+    GameState state(maxGuesses);
+    PlayerStats stats;
+    newGame(state, StrView(word.data(), word.size()), StrView(hint.data(), hint.size()), maxGuesses);  // hint outlives the game state.
+
+    cout << "Welcome to Hangman!" << endl;
+    while (gameStatus(state) == GAME_IN_PROGRESS) {  // Game loop
+        displayGameState(state);
+        if (!processPlayerGuess(state)) {
+            cout << "You have " << state.maxGuesses - state.incorrectGuesses << " incorrect guesses remaining." << endl;
+        }
+    }
+    endGameDisplay(state, stats);
+}
+
 // =========== INTERACTIVE MULTIPLAYER FUNCTION ============ //
 
 /**
@@ -588,6 +4798,7 @@ void playInteractiveMultiplayer() {
     string hint;
     int maxGuesses;
     setupDifficulty(maxGuesses);
+    PlayerStats stats;
 
     do {
         cout << "Welcome to Hangman Interactive Multiplayer!\n";
@@ -599,21 +4810,20 @@ void playInteractiveMultiplayer() {
         getline(cin, hint);
         clearScreen();
 
+        normalizeText(word);
+        normalizeText(hint);
         GameState state(maxGuesses);
-        state.chosenWord = word;
-        state.chosenHint = hint;
-        convertToUpper(state.chosenWord);
-        convertToUpper(state.chosenHint);
+        newGame(state, StrView(word.data(), word.size()), StrView(hint.data(), hint.size()), maxGuesses);  // hint outlives the round's game state.
 
         // player 2 guesses the word
         cout << "Player 2, you will now guess the word.\n";
-        while (state.incorrectGuesses < state.maxGuesses && !state.wordGuessed) {
+        while (gameStatus(state) == GAME_IN_PROGRESS) {
             displayGameState(state);
             if (!processPlayerGuess(state)) {
                 cout << "You have " << state.maxGuesses - state.incorrectGuesses << " incorrect guesses remaining." << endl;
             }
         }
-        endGameDisplay(state);
+        endGameDisplay(state, stats);
 
     } while (promptToPlayAgain());
     return;
@@ -628,11 +4838,11 @@ void playInteractiveMultiplayer() {
  * @param playerState The game state and statistics for the player whose turn just ended.
  */
 void multiplayerEndGameDisplay(PlayerState& playerState) {
-    if (playerState.state.wordGuessed) {
-        playerState.totalWins++;
+    GameStatus status = gameStatus(playerState.state);
+    recordGameResult(playerState.stats, status);
+    if (status == GAME_WON) {
         cout << "Congratulations, " << playerState.playerName << ", you've guessed the word: " << playerState.state.chosenWord << endl;
-    } else if (playerState.state.incorrectGuesses == playerState.state.maxGuesses) {
-        playerState.totalLosses++;
+    } else if (status == GAME_LOST) {
         drawGallows(playerState.state.incorrectGuesses, playerState.state.maxGuesses);
         cout << "Sorry, " << playerState.playerName << ", you've been hanged." << endl;
         cout << "The correct word was: " << playerState.state.chosenWord << endl;
@@ -640,7 +4850,7 @@ void multiplayerEndGameDisplay(PlayerState& playerState) {
         cerr << "Invalid game state for player " << playerState.playerName << endl;
     }
 
-    cout << playerState.playerName << " has won " << playerState.totalWins << " rounds and lost " << playerState.totalLosses << " rounds.\n";
+    cout << playerState.playerName << " has won " << playerState.stats.wonRounds << " rounds and lost " << playerState.stats.lostRounds << " rounds.\n";
 }
 
 /**
@@ -651,38 +4861,53 @@ void multiplayerEndGameDisplay(PlayerState& playerState) {
  * @param player2 The game state for player 2, including win/loss statistics.
  */
 void printMultiplayerStats(const PlayerState& player1, const PlayerState& player2) {
-    cout << "Player 1: " << player1.totalWins << " wins, " << player1.totalLosses << " losses. \n";
-    cout << "Player 2: " << player2.totalWins << " wins, " << player2.totalLosses << " losses. \n";
+    cout << "Player 1: " << player1.stats.wonRounds << " wins, " << player1.stats.lostRounds << " losses. \n";
+    cout << "Player 2: " << player2.stats.wonRounds << " wins, " << player2.stats.lostRounds << " losses. \n";
 }
 
 /**
  * @brief Sets up a multiplayer game by selecting a random word and hint from the provided list for both players.
+ * The word is drawn from the session's shuffle bag, and chosen to suit the difficulty when the list has a matching word.
  * Initializes the game state for both players with the same word and hint to ensure a fair game.
  * @param state1 Game state for player 1.
  * @param state2 Game state for player 2.
- * @param wordList Vector containing the list of wordItem structures to choose from.
+ * @param wordList The loaded word list to choose from.
+ * @param weights The published selection weights, or null when there are none.
+ * @param shard The shard to choose from, or empty for the whole list.
+ * @param scheduler The session's shuffle bag, so words do not repeat between games.
  */
-void multiplayerSetup(GameState& state1, GameState& state2, const vector<WordItem>& wordList) {
-    int wordIndex = rand() % wordList.size(); // Randomly select a word from the list for both players
-    state1.chosenWord = wordList[wordIndex].word;
-    state1.chosenHint = wordList[wordIndex].hint;
-    state2.chosenWord = wordList[wordIndex].word;
-    state2.chosenHint = wordList[wordIndex].hint;
+void multiplayerSetup(GameState& state1, GameState& state2, const WordList& wordList, const WordWeights* weights, const string& shard,
+                      WordScheduler& scheduler) {
+    size_t wordIndex = scheduleWord(wordList, weights, difficultyWordShape(state1.maxGuesses), shard, scheduler); // Same word for both players
+    string decoded;  // Holds the word when it is decoded from a front-coded list
+    StrView word = wordList.playedWord(wordIndex, decoded);
+    StrView hint = wordList.playedHint(wordIndex);
+    newGame(state1, word, hint, state1.maxGuesses, wordList.letterMask(wordIndex));
+    newGame(state2, word, hint, state2.maxGuesses, wordList.letterMask(wordIndex));
 }
 
 /**
  * @brief Manages the main multiplayer game loop, alternating turns between players.
  * Each player gets a chance to guess letters or the whole word, with the game updating and displaying
  * the state after each guess. The game continues until one or both players have guessed the word or exhausted their guesses.
- * @param wordList Vector of wordItem structures containing the words and hints for the game.
+ * Each game takes the latest word list snapshot and holds it until the game ends.
+ * @param wordStore The store publishing the word list containing the words and hints for the game.
+ * @param random The session's generator, which picks its words.
  */
-void playMultiplayer(const vector<WordItem>& wordList) {
+void playMultiplayer(const WordListStore& wordStore, const RandomGenerator& random) {
+    waitForWordList(wordStore);
     int maxGuesses;
     setupDifficulty(maxGuesses);
 
+    WordListSnapshot snapshot = wordStore.snapshot();  // The players' hint views point into this snapshot.
+    if (snapshot->empty()) {
+        cerr << "No words available to play." << endl;
+        return;
+    }
     PlayerState player1{GameState(maxGuesses), "Player 1"}; // Construct player states with the same word and hint
     PlayerState player2{GameState(maxGuesses), "Player 2"};
-    multiplayerSetup(player1.state, player2.state, wordList);
+    WordScheduler scheduler(random);  // No word repeats within the session until every matching word has been played.
+    multiplayerSetup(player1.state, player2.state, *snapshot, wordStore.weights().get(), wordStore.shard(), scheduler);
 
     bool playAgain;
     do {
@@ -691,31 +4916,36 @@ void playMultiplayer(const vector<WordItem>& wordList) {
 
         while (gameActive) {  // game loop for multiplayer mode, pointers to player states allow for easy iteration for player turns
             for (auto& currentPlayer : {&player1, &player2}) {
-                if (!currentPlayer->state.wordGuessed && currentPlayer->state.incorrectGuesses < currentPlayer->state.maxGuesses) {
+                if (gameStatus(currentPlayer->state) == GAME_IN_PROGRESS) {
                     cout << currentPlayer->playerName << "'s turn." << endl;
                     displayGameState(currentPlayer->state);
                     processPlayerGuess(currentPlayer->state);
                     cout << "You have " << currentPlayer->state.maxGuesses - currentPlayer->state.incorrectGuesses << " incorrect guesses remaining." << endl;
 
-                    if (currentPlayer->state.wordGuessed) {
+                    GameStatus status = gameStatus(currentPlayer->state);
+                    if (status == GAME_WON) {
                         multiplayerEndGameDisplay(*currentPlayer);
                         gameActive = false;  // End the game immediately if any player guesses correctly
                         break;
-                    } else if (currentPlayer->state.incorrectGuesses >= currentPlayer->state.maxGuesses) {
+                    } else if (status == GAME_LOST) {
                         multiplayerEndGameDisplay(*currentPlayer);
                     }
                 }
             }
             // Continue if both players still have unguessed words and guesses left
-            gameActive = gameActive && ((player1.state.incorrectGuesses < player1.state.maxGuesses && !player1.state.wordGuessed) ||
-                                        (player2.state.incorrectGuesses < player2.state.maxGuesses && !player2.state.wordGuessed));
+            gameActive = gameActive && (gameStatus(player1.state) == GAME_IN_PROGRESS || gameStatus(player2.state) == GAME_IN_PROGRESS);
         }
         printMultiplayerStats(player1, player2);
 
         if (promptToPlayAgain()) {
             player1.state = GameState(maxGuesses);
             player2.state = GameState(maxGuesses);
-            multiplayerSetup(player1.state, player2.state, wordList);
+            snapshot = wordStore.snapshot();  // Pick up words added since the last game.
+            if (snapshot->empty()) {
+                cerr << "No words available to play." << endl;
+                break;
+            }
+            multiplayerSetup(player1.state, player2.state, *snapshot, wordStore.weights().get(), wordStore.shard(), scheduler);
         } else {
             break;
         }
@@ -731,18 +4961,21 @@ void playMultiplayer(const vector<WordItem>& wordList) {
  * the mode selection until the exit condition is met. Each game mode utilizes a shared list of words
  * and hints for gameplay, ensuring consistency across game sessions.
  * The function concludes by thanking the player once they decide to exit the game.
- * @param wordList Vector of wordItem structures containing words and hints. This list is passed to game modes
+ * @param wordStore The store publishing the word list containing words and hints. It is passed to game modes
  * to select words for the player(s) to guess.
+ * @param seed The seed of the run; each session draws its words from its own stream of it, so a run with the same seed
+ * and the same choices picks the same words.
  */
-void playGame(const vector<WordItem>& wordList) {
+void playGame(const WordListStore& wordStore, uint64_t seed) {
+    uint64_t sessions = 0;  // Sessions started so far, numbering each session's stream
     GameMode mode = modeMenu();  // Set the initial mode
     while (mode != EXIT_GAME) {
         switch (mode) {
             case SINGLE_PLAYER:
-                playSingleplayer(wordList);
+                playSingleplayer(wordStore, RandomGenerator(seed, sessions++));
                 break;
             case TWO_PLAYER:
-                playMultiplayer(wordList);
+                playMultiplayer(wordStore, RandomGenerator(seed, sessions++));
                 break;
             case INTERACTIVE_TWO_PLAYER:
                 playInteractiveMultiplayer();